@@ -2,6 +2,9 @@
 #define ASSIGNMENT_2_NEW_SERIALISABLE_H
 
 #include <iostream>
+#include <string>
+#include <type_traits>
+#include <utility>
 
 /*
  * An abstract class which delineates that a class IS serialisable, and that
@@ -30,5 +33,20 @@ public:
     virtual ~Serialisable() = 0;
 };
 
+/*
+ * A compile-time check that a type can be serialised, either by being Serialisable or, for plain
+ * values that should not carry a virtual table (i.e., Tile), by having its own
+ * serialiseToString() that returns a string. IsSerialisable<T>::value is true if it can.
+ */
+template<typename T, typename = void>
+struct IsSerialisable : std::false_type {
+};
+
+template<typename T>
+struct IsSerialisable<T, typename std::enable_if<std::is_convertible<
+        decltype(std::declval<T &>().serialiseToString()), std::string>::value>::type>
+        : std::true_type {
+};
+
 
 #endif //ASSIGNMENT_2_NEW_SERIALISABLE_H
@@ -1,9 +1,6 @@
 #include "Player.h"
 
-Player::~Player() {
-    delete this->hand;
-    delete this->historyOfTurns;
-}
+Player::~Player() = default;
 
 std::string Player::getName() {
     return this->name;
@@ -21,96 +18,60 @@ void Player::deductPoints(int pointsToDeduct) {
     this->score -= pointsToDeduct;
 }
 
-Tile *Player::getTileToPlace(char letterOfTileToPlace) {
-    return this->getTileFromHand(letterOfTileToPlace, "place");
+bool Player::getTileToPlace(char letterOfTileToPlace, Tile &tileToPlace) {
+    return this->getTileFromHand(letterOfTileToPlace, TurnAction::PLACE, tileToPlace);
 }
 
-Tile *Player::getTileToReplace(char letterOfTileToReplace) {
-    return this->getTileFromHand(letterOfTileToReplace, "replace");
+bool Player::getTileToReplace(char letterOfTileToReplace, Tile &tileToReplace) {
+    return this->getTileFromHand(letterOfTileToReplace, TurnAction::REPLACE, tileToReplace);
 }
 
 /*
- * Given that all letter types share the same points, then we only need to find the first letter
- * in the player's hand that has the same letter (i.e., all A's will be associated with 1 point).
+ * Given that all letter types share the same points, then we only need to find a tile in the
+ * player's hand that has the same letter (i.e., all A's will be associated with 1 point).
  */
-Tile *Player::getTileFromHand(char letterOfTile, const std::string &history) {
-    Node<Tile> *nodeFound = nullptr;
-    Tile *tileToReturn = nullptr;
-
-    for (int i = 0; i < this->hand->size(); ++i) {
-        Node<Tile> *currNode = (*this->hand)[i];
-        if (currNode->getValue()->getLetter() == letterOfTile) {
-            nodeFound = currNode;
-        }
-    }
+bool Player::getTileFromHand(char letterOfTile, TurnAction action, Tile &tileFound) {
+    bool found = hand.remove(letterOfTile, tileFound);
 
-    if (nodeFound != nullptr) {
-        tileToReturn = new Tile(*nodeFound->getValue());
-        hand->removeNode(nodeFound);
-        this->historyOfTurns->push_back(history);
+    if (found) {
+        recordAction(action);
     }
 
-    return tileToReturn;
+    return found;
 }
 
 
-void Player::addTilesToHand(LinkedList<Tile> *tilesToAdd) {
-    for (int i = 0; i < tilesToAdd->size(); ++i) {
-        Tile *newTile = new Tile(*tilesToAdd->get(i));
-        this->hand->add(newTile);
-    }
-
-    delete tilesToAdd;
-}
-
-void Player::addTileToHand(Tile *tileToAdd) {
-    this->hand->add(tileToAdd);
+void Player::addTileToHand(const Tile &tileToAdd) {
+    this->hand.add(tileToAdd);
 }
 
 void Player::displayHand() {
     std::cout << "Your hand is:" << std::endl;
-
-    for (int i = 0; i < this->hand->size(); ++i) {
-        Tile *t = (*this->hand)[i]->getValue();
-        if (i == this->hand->size() - 1) {
-            std::cout << t->getLetter() << "-" << t->getValue();
-        } else {
-            std::cout << t->getLetter() << "-" << t->getValue() << ", ";
-        }
-    }
-
-    std::cout << std::endl;
+    // Shown the same way as it is saved.
+    std::cout << this->hand.serialiseToString() << std::endl;
 }
 
 std::string Player::serialiseToString() {
     std::string serialisedPlayer;
     serialisedPlayer.append(this->getName()).append("\n");
     serialisedPlayer.append(std::to_string(this->getScore())).append("\n");
-    serialisedPlayer.append(this->hand->serialiseToString());
+    serialisedPlayer.append(this->hand.serialiseToString());
 
     return serialisedPlayer;
 }
 
 int Player::handSize() {
-    return this->hand->size();
+    return this->hand.size();
 }
 
 void Player::pass() {
-    this->historyOfTurns->push_back("pass");
+    recordAction(TurnAction::PASS);
 }
 
 bool Player::hasPassedTwiceConsecutively() {
-    bool passedTwice = false;
-
-    // Must check if the player has had at least two turns, to prevent invalid access.
-    if (historyOfTurns->size() > 1) {
-        for (std::size_t i = 0; i < historyOfTurns->size() - 1; ++i) {
-            if ((*historyOfTurns)[i] == "pass" && (*historyOfTurns)[i + 1] == "pass") {
-                passedTwice = true;
-            }
-        }
-    }
-    return passedTwice;
+    return consecutivePasses >= 2;
 }
 
-
+void Player::recordAction(TurnAction action) {
+    consecutivePasses = action == TurnAction::PASS ? consecutivePasses + 1 : 0;
+}
@@ -1,31 +1,37 @@
 #ifndef ASSIGNMENT_2_PLAYER_H
 #define ASSIGNMENT_2_PLAYER_H
 
+#include <cstdint>
 #include <iostream>
 #include <utility>
 #include <vector>
-#include "../utility/LinkedList.h"
+#include "../contract/Serialisable.h"
 #include "Tile.h"
+#include "Rack.h"
 #include "../utility/typedefs.h"
 
+// The things a player can do on their turn (placing being done a tile at a time).
+enum class TurnAction : std::uint8_t {
+    PLACE, REPLACE, PASS
+};
+
 class Player : public Serialisable {
 public:
     explicit Player(std::string name) : name(std::move(name)) {
-        this->hand = new LinkedList<Tile>();
-        this->historyOfTurns = new StringVec();
         this->score = 0;
+        this->consecutivePasses = 0;
     };
 
-    Player(std::string name, LinkedList<Tile> *hand)
+    Player(std::string name, const Rack &hand)
             : name(std::move(name)), hand(hand) {
-        this->historyOfTurns = new StringVec();
         this->score = 0;
+        this->consecutivePasses = 0;
     };
 
     // For loading a game (everything should be passed, except turn history).
-    Player(std::string name, LinkedList<Tile> *hand, int score)
+    Player(std::string name, const Rack &hand, int score)
             : name(std::move(name)), score(score), hand(hand) {
-        this->historyOfTurns = new StringVec();
+        this->consecutivePasses = 0;
     };
 
     ~Player() override;
@@ -42,11 +48,10 @@ public:
     // Deduct points to the player's score.
     void deductPoints(int pointsToDeduct);
 
-    void addTileToHand(Tile *tileToAdd);
-
-    void addTilesToHand(LinkedList<Tile> *tilesToAdd);
+    // Adds a copy of the tile to the player's hand.
+    void addTileToHand(const Tile &tileToAdd);
 
-    // Adds to historyOfTurns list to allow for passing twice checks.
+    // Records a pass, to allow for passing twice checks.
     void pass();
 
     // Checks if the player has passed twice in a row.
@@ -59,28 +64,35 @@ public:
     std::string serialiseToString() override;
 
     /*
-     * Gets the tile to place, so that it can be given to the  board.
+     * Gets the tile to place, so that it can be given to the board.
      *
-     * Returns nullptr if the player does not have the desired letter in their
-     * hand, else it returns the tile and removes it from their hand.
+     * Returns false if the player does not have the desired letter in their
+     * hand, else it copies the tile into tileToPlace and removes it from their hand.
      */
-    Tile *getTileToPlace(char letterOfTileToPlace);
+    bool getTileToPlace(char letterOfTileToPlace, Tile &tileToPlace);
 
     /*
      * Gets the tile to replace, so that it can be given to Scrabble's tileBag.
      *
-     * Returns nullptr if the player does not have the desired letter in their
-     * hand, else it returns the tile and removes it from their hand.
+     * Returns false if the player does not have the desired letter in their
+     * hand, else it copies the tile into tileToReplace and removes it from their hand.
      */
-    Tile *getTileToReplace(char letterOfTileToReplace);
+    bool getTileToReplace(char letterOfTileToReplace, Tile &tileToReplace);
 
 private:
-    Tile *getTileFromHand(char letterOfTile, const std::string &history);
+    bool getTileFromHand(char letterOfTile, TurnAction action, Tile &tileFound);
+
+    // Keeps the count of consecutive passes up to date with the player's latest action.
+    void recordAction(TurnAction action);
 
     std::string name;
     int score;
-    LinkedList<Tile> *hand;
-    StringVec* historyOfTurns;
+    Rack hand;
+    /*
+     * The number of passes since the player last did anything else. Only this is needed from
+     * their turn history, so nothing more is kept.
+     */
+    int consecutivePasses;
 };
 
 #endif //ASSIGNMENT_2_PLAYER_H
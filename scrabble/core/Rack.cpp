@@ -0,0 +1,102 @@
+#include "Rack.h"
+#include "TileCodec.h"
+
+// Pre-C++17, static constants that are bound to references still need a definition.
+const int Rack::SLOTS;
+const int Rack::NONE;
+
+Rack::Rack() : counts() {
+    for (int &place: latest) {
+        place = NONE;
+    }
+}
+
+void Rack::add(const Tile &tile) {
+    int slot = getSlot(tile.getLetter());
+    int place = static_cast<int>(tiles.size());
+
+    tiles.push_back(tile);
+    earlier.push_back(latest[slot]);
+    later.push_back(NONE);
+    if (latest[slot] != NONE) {
+        later[latest[slot]] = place;
+    }
+    latest[slot] = place;
+    ++counts[slot];
+}
+
+bool Rack::contains(Letter letter) const {
+    return counts[getSlot(letter)] != 0;
+}
+
+int Rack::getCount(Letter letter) const {
+    return counts[getSlot(letter)];
+}
+
+const std::uint8_t *Rack::getCounts() const {
+    return counts;
+}
+
+bool Rack::remove(Letter letter, Tile &removed) {
+    int slot = getSlot(letter);
+    bool held = counts[slot] != 0;
+
+    if (held) {
+        // Unthread the slot's latest tile, which nothing comes after.
+        int place = latest[slot];
+        removed = tiles[place];
+        latest[slot] = earlier[place];
+        if (earlier[place] != NONE) {
+            later[earlier[place]] = NONE;
+        }
+        --counts[slot];
+
+        // Move the last tile into its place, and point its neighbours in its thread at it there.
+        int last = static_cast<int>(tiles.size()) - 1;
+        if (place != last) {
+            tiles[place] = tiles[last];
+            earlier[place] = earlier[last];
+            later[place] = later[last];
+
+            if (earlier[place] != NONE) {
+                later[earlier[place]] = place;
+            }
+            if (later[place] != NONE) {
+                earlier[later[place]] = place;
+            } else {
+                latest[getSlot(tiles[place].getLetter())] = place;
+            }
+        }
+
+        tiles.pop_back();
+        earlier.pop_back();
+        later.pop_back();
+    }
+
+    return held;
+}
+
+int Rack::size() const {
+    return static_cast<int>(tiles.size());
+}
+
+const std::vector<Tile> &Rack::getTiles() const {
+    return tiles;
+}
+
+std::string Rack::serialiseToString() const {
+    std::string serialisedRack;
+
+    for (std::size_t i = 0; i < tiles.size(); ++i) {
+        if (i != 0) {
+            serialisedRack.append(", ");
+        }
+        serialisedRack.append(TileCodec::encode(tiles[i]));
+    }
+
+    return serialisedRack;
+}
+
+int Rack::getSlot(Letter letter) {
+    return letter >= 'A' && letter <= 'Z' ? letter - 'A' : SLOTS - 1;
+}
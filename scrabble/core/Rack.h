@@ -0,0 +1,73 @@
+#ifndef ASSIGNMENT_2_NEW_RACK_H
+#define ASSIGNMENT_2_NEW_RACK_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Tile.h"
+
+/*
+ * A player's hand, stored as a multiset: a count of the tiles of each letter (one slot per letter,
+ * plus one for blanks and anything else that is not a letter). Whether a letter is held, and how
+ * many of it, is therefore a single lookup, as is working out the leave of a move (the counts
+ * less the letters played).
+ *
+ * The tiles are also kept in the order they are shown and saved in: a tile added goes after the
+ * rest, and a tile taken out leaves its place to the last tile, so that neither has to shift the
+ * tiles along. Each slot's tiles are threaded through their places in that order, so that a tile
+ * of any letter is found and taken out without a search.
+ */
+class Rack {
+public:
+    // One slot per letter, plus one for every other tile.
+    static const int SLOTS = 27;
+
+    Rack();
+
+    // Adds a tile after the rest of the tiles.
+    void add(const Tile &tile);
+
+    /*
+     * Return whether a tile of the letter is held, and how many are. Tiles that are not letters
+     * share a slot, so are counted together.
+     */
+    bool contains(Letter letter) const;
+
+    int getCount(Letter letter) const;
+
+    // Returns the count of each slot (see getSlot()).
+    const std::uint8_t *getCounts() const;
+
+    /*
+     * Takes the latest tile of a letter (the last of them added that is still held) out of the
+     * rack, and copies it into removed. Returns false (leaving removed alone) if no tile of the
+     * letter is held. Like contains(), tiles that are not letters are all taken as one.
+     */
+    bool remove(Letter letter, Tile &removed);
+
+    // Returns the number of tiles held.
+    int size() const;
+
+    // Returns the tiles held, in the order they are shown.
+    const std::vector<Tile> &getTiles() const;
+
+    // Serialises the tiles in order (i.e., A-1, B-3), as a list of tiles would be.
+    std::string serialiseToString() const;
+
+    // Returns the slot that a letter is counted in (0 to 25 for 'A' to 'Z', otherwise 26).
+    static int getSlot(Letter letter);
+
+private:
+    // Marks the end of a slot's thread.
+    static const int NONE = -1;
+
+    std::uint8_t counts[SLOTS];
+    std::vector<Tile> tiles;
+    // The place of each slot's latest tile in tiles, or NONE if it holds none.
+    int latest[SLOTS];
+    // For the tile in each place, the places of the tiles of its slot added before and after it.
+    std::vector<int> earlier;
+    std::vector<int> later;
+};
+
+#endif //ASSIGNMENT_2_NEW_RACK_H
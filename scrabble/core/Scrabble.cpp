@@ -1,12 +1,17 @@
 #include "Scrabble.h"
 #include <vector>
 #include <algorithm>
+#include "TileCodec.h"
+#include "lexicon/LexiconRegistry.h"
+
+// The letters that tiles can have (whatever the size of the board, which has its own range).
+static const char FIRST_TILE_LETTER = 'A';
+static const char LAST_TILE_LETTER = 'Z';
 
 Scrabble::~Scrabble() {
     delete this->tileBag;
     delete this->board;
     delete this->playerTurnsOrder;
-    delete this->wordsList;
     delete this->letterToPointsMap;
 }
 
@@ -32,42 +37,30 @@ void Scrabble::createTileBag(const std::string &fileToConsume) {
 
             int quantity = std::stoi((*args)[2]);
 
-            for (int i = 0; i < quantity; ++i) {
-                Tile *newTile = new Tile(l, val);
-                this->tileBag->add(newTile);
-            }
+            this->tileBag->add(Tile(l, val), quantity);
+            delete args;
         }
     }
 
     TilesFile.close();
 }
 
-Tile *Scrabble::replaceTile(Tile *tileToReplace) {
-    this->tileBag->add(tileToReplace);
-    return this->tileBag->pollFirst();
-}
+Tile Scrabble::replaceTile(const Tile &tileToReplace) {
+    // With nothing left to draw, the player simply keeps their tile.
+    Tile newTile = tileToReplace;
 
-void Scrabble::shuffleTileBag() {
-    // Set up an array to copy in the tiles from the tileBag, this array wil be what is shuffled
-    int tileBagSize = this->tileBag->size();
-    Tile *temp[tileBagSize];
-    for (int i = 0; i < tileBagSize; i++) {
-        temp[i] = this->tileBag->pollFirst();
-    }
-    // Seed a random number to ensure each compile of the program results in a random tileBag
-    srand(time(nullptr));
-    // Shuffle the array using the random seed for all tiles in the array
-    for (int i = 0; i < tileBagSize; i++) {
-        int index = rand() % tileBagSize;
-        Tile *rand_tile = temp[i];
-        temp[i] = temp[index];
-        temp[index] = rand_tile;
-    }
-    // Return the shuffled tiles into the tileBag, which will now be the tileBag that is
-    // initialised when the game starts
-    for (int i = 0; i < tileBagSize; i++) {
-        this->tileBag->add(temp[i]);
+    // Draw before returning the tile, so that it cannot be drawn straight back out.
+    if (!this->tileBag->isEmpty()) {
+        newTile = drawTile();
+        this->tileBag->add(tileToReplace);
     }
+
+    return newTile;
+}
+
+Tile Scrabble::drawTile() {
+    return this->tileBag->drawAt(
+            static_cast<int>(random.nextBelow(static_cast<std::uint32_t>(this->tileBag->size()))));
 }
 
 void Scrabble::startGame(bool loadedGame) {
@@ -78,9 +71,12 @@ void Scrabble::startGame(bool loadedGame) {
     if (loadedGame) {
         std::cin.ignore();
     } else {
+        // The seed is all it takes to deal the same tiles again (see the -seed argument).
+        std::cout << "Tiles are drawn with seed " << random.getSeed() << std::endl;
+
         players->forEach([this](Player *currPly) {
             playerTurnsOrder->enqueue(currPly);
-            currPly->addTilesToHand(getRandomTiles(7));
+            dealTiles(currPly, 7);
         });
     }
 
@@ -157,12 +153,11 @@ void Scrabble::gameplay() {
         // If game has not ended refill tiles if necessary and cycle through next turn.
         if (this->tileBag->size() > 7) {
             if (currPly->handSize() < 7 && gameInProgress) {
-                currPly->addTilesToHand(getRandomTiles(7 - currPly->handSize()));
+                dealTiles(currPly, 7 - currPly->handSize());
             }
         } else {
             if (currPly->handSize() < 7 && gameInProgress) {
-                currPly->addTilesToHand(
-                        getRandomTiles(this->tileBag->size() - currPly->handSize()));
+                dealTiles(currPly, this->tileBag->size() - currPly->handSize());
             }
         }
     } while (gameInProgress);
@@ -221,12 +216,13 @@ StringVec *Scrabble::validateCommandArguments(StringVec *args, Player *currPly)
             if ((*args)[1].length() > 1) {
                 validLetter = false;
             } else {
-                validLetter = isLetterValid((*args)[1][0], 'A', 'Z');
+                validLetter = isLetterValid((*args)[1][0], FIRST_TILE_LETTER, LAST_TILE_LETTER);
             }
         }
 
         if (validPlaceCommand) {
-            validLocation = isLocationValid((*args)[3], 'O', 14);
+            validLocation = isLocationValid((*args)[3], static_cast<char>('A' + board->getSize() - 1),
+                                            board->getSize() - 1);
         }
 
         rangeIsValid = validLetter && validLocation;
@@ -239,15 +235,19 @@ StringVec *Scrabble::validateCommandArguments(StringVec *args, Player *currPly)
                       << "2. \"replace [letter]\", where letter = character."
                       << std::endl
                       << "3. \"pass\"" << std::endl;
+            delete args;
             args = promptInput(currPly);
         } else if (!validLetter) {
-            std::cout << "That is not a valid letter. Please enter a "
-                         "letter between A-O." << std::endl;
+            std::cout << "That is not a valid letter. Please enter a letter between "
+                      << FIRST_TILE_LETTER << "-" << LAST_TILE_LETTER << "." << std::endl;
+            delete args;
             args = promptInput(currPly);
         } else if (!validLocation) {
             std::cout << "That is not a valid location. Please enter a letter "
-                         "between A-O, followed by a number between 0-14 "
-                         "(i.e., B9 or F0 or M11)" << std::endl;
+                         "between A-" << static_cast<char>('A' + board->getSize() - 1)
+                      << ", followed by a number between 0-" << board->getSize() - 1
+                      << " (i.e., B9 or F0 or M11)" << std::endl;
+            delete args;
             args = promptInput(currPly);
         }
     } while (!cmdStructureValid || !rangeIsValid);
@@ -287,8 +287,7 @@ void Scrabble::parseCommand(Player *currPly) {
     // A player can have multiple "turns" if they place multiple times.
     bool turnOver = false;
     bool bingoOperation = false;
-    auto *tilesToPlace = new std::vector<std::tuple<Tile *, char, int> >();
-    auto *wordsPlacedNew = new StringVec();
+    std::vector<std::tuple<Tile, char, int> > tilesToPlace;
 
     while (!turnOver) {
         // Validate command + argument(s) syntax.
@@ -316,7 +315,14 @@ void Scrabble::parseCommand(Player *currPly) {
                                  "previously placed something. If you wish to "
                                  "skip your turn, please use the \"pass\" command." << std::endl;
                 } else {
-                    auto words = board->getAllNewWordsOnBoard(wordsPlacedNew);
+                    // Only the lines through the tiles placed this turn can hold new words.
+                    std::vector<std::pair<int, int> > placedSquares;
+                    for (auto tuple: tilesToPlace) {
+                        placedSquares.push_back(Board::logicalCoordsToIndexes(
+                                std::get<1>(tuple), std::get<2>(tuple)));
+                    }
+
+                    auto words = board->getNewWords(placedSquares);
 
                     /*
                      * If the word correcting feature is not enabled, then we don't want to validate
@@ -334,19 +340,15 @@ void Scrabble::parseCommand(Player *currPly) {
                             currPly->addPoints(50);
                         }
 
-                        for (int i = 0; i < words->size(); ++i) {
-                            for (int j = 0; j < (*words)[i]->size(); ++j) {
-                                currPly->addPoints((*words)[i]->get(j)->getValue());
-                            }
-                        }
+                        // Premium squares only count for the tiles placed this turn.
+                        currPly->addPoints(board->scoreMove(placedSquares));
 
-                        /*
-                         * We must update the wordsPlaced list, so that it now reflects all the
-                         * words that are CURRENTLY on the board. This will be useful for the next
-                         * turn, when we need to work out what NEW words the player currently placed
-                         * (if any), and then calculate the total points earned for these new words.
-                         */
-                        board->setWordsPlaced(wordsPlacedNew);
+                        // Record the words formed, so that they are kept in the saved game.
+                        StringVec wordsPlacedNew;
+                        for (auto &word: words) {
+                            wordsPlacedNew.emplace_back(word.start, word.length);
+                        }
+                        board->addWordsPlaced(wordsPlacedNew);
 
                         // End turn if they "place done" validly.
                         turnOver = true;
@@ -359,17 +361,18 @@ void Scrabble::parseCommand(Player *currPly) {
                         }
 
                         // We should add all the tiles taken from the player's hand back to their hand.
-                        for (auto tuple: *tilesToPlace) {
+                        for (auto tuple: tilesToPlace) {
                             currPly->addTileToHand(std::get<0>(tuple));
                         }
 
-                        // Remove all the tiles we placed on the board.
-                        for (auto tuple: *tilesToPlace) {
-                            board->removeTile(std::get<1>(tuple), std::get<2>(tuple));
-                        }
+                        // Remove all the tiles we placed on the board (which were all one move).
+                        board->undoMove();
 
-                        // Need to reset wordsPlacedNew.
-                        wordsPlacedNew->clear();
+                        /*
+                         * Need to forget the undone placements, so that they are neither searched
+                         * for words nor handed back again next time.
+                         */
+                        tilesToPlace.clear();
 
                         // Need to reset previously placed cmds count.
                         previousPlaceCmds = 0;
@@ -381,10 +384,10 @@ void Scrabble::parseCommand(Player *currPly) {
                     }
                 }
             } else { // Must be a place command (i.e., place X at Y).
-                Tile *tileToPlace = currPly->getTileToPlace(toPlace[0]);
+                Tile tileToPlace;
 
                 // If the tile was not found in their hand, then it is invalid.
-                if (tileToPlace == nullptr) {
+                if (!currPly->getTileToPlace(toPlace[0], tileToPlace)) {
                     std::cout << "You do not have a tile with the letter " << toPlace
                               << ". Please choose another from your hand." << std::endl;
                     currPly->displayHand();
@@ -410,8 +413,13 @@ void Scrabble::parseCommand(Player *currPly) {
                          * the word(s) created by the placement, and to undo the placements
                          * in-case of an invalid placement(s).
                          */
-                        tilesToPlace->push_back(std::make_tuple(tileToPlace, row, col));
-                        board->placeTile(*tileToPlace, row, col);
+                        tilesToPlace.push_back(std::make_tuple(tileToPlace, row, col));
+
+                        // The first tile placed starts the move, so that it can be undone whole.
+                        if (previousPlaceCmds == 0) {
+                            board->beginMove();
+                        }
+                        board->placeTile(tileToPlace, row, col);
                         ++previousPlaceCmds;
 
                         // Special "Bingo" operation.
@@ -428,16 +436,15 @@ void Scrabble::parseCommand(Player *currPly) {
             }
         } else if (baseSyntax == "replace" && previousPlaceCmds == 0) {
             // Get the tile to replace from the player's hand.
-            Tile *tileToReplace = currPly->getTileToReplace((*args)[1][0]);
+            Tile tileToReplace;
 
-            if (tileToReplace == nullptr) {
+            if (!currPly->getTileToReplace((*args)[1][0], tileToReplace)) {
                 std::cout << "You do not have tile " << (*args)[1][0] << " in your hand."
                           << std::endl;
             } else {
                 // Give the tile to the tilebag, and get a new tile.
-                Tile *newTile = replaceTile(tileToReplace);
                 // Give the new tile to the player.
-                currPly->addTileToHand(newTile);
+                currPly->addTileToHand(replaceTile(tileToReplace));
                 // End the turn.
                 turnOver = true;
             }
@@ -448,6 +455,7 @@ void Scrabble::parseCommand(Player *currPly) {
             saveGame(currPly, (*args)[1]);
         } else if (baseSyntax == "quit") {
             std::cout << std::endl;
+            delete args;
             throw std::runtime_error("Program forcibly quit by user.");
         } else {
             /*
@@ -462,6 +470,8 @@ void Scrabble::parseCommand(Player *currPly) {
                     << "You cannot pass or replace if you have already placed tile(s)!"
                        "\nPlease use \"place Done\" instead." << std::endl;
         }
+
+        delete args;
     }
 }
 
@@ -491,23 +501,18 @@ bool Scrabble::isLetterValid(char letter, char minValidLetter, char maxValidLett
     return letter >= minValidLetter && letter <= maxValidLetter;
 }
 
-LinkedList<Tile> *Scrabble::getRandomTiles(int amtToGet) {
-    auto *newHand = new LinkedList<Tile>();
-
+void Scrabble::dealTiles(Player *ply, int amtToGet) {
     // Take out amtToGet tiles. However, if we have run out, do not try to take out anymore.
     // The game will end after this.
-    for (int i = 0; i < amtToGet && this->tileBag->size() != 0; ++i) {
-        Tile *tile = this->tileBag->pollFirst();
-        newHand->add(tile);
+    for (int i = 0; i < amtToGet && !this->tileBag->isEmpty(); ++i) {
+        ply->addTileToHand(drawTile());
     }
-
-    return newHand;
 }
 
 Player *Scrabble::readInPlayer(std::ifstream &SavedGameFile) {
     std::string playerName;
     int playerScore;
-    auto *playerTiles = new LinkedList<Tile>();
+    Rack playerTiles;
     std::string line;
 
     std::getline(SavedGameFile, line);
@@ -517,15 +522,16 @@ Player *Scrabble::readInPlayer(std::ifstream &SavedGameFile) {
     playerScore = std::stoi(line);
 
     std::getline(SavedGameFile, line);
-    fillLinkedList(playerTiles, line);
+    fillRack(playerTiles, line);
 
     return new Player(playerName, playerTiles, playerScore);
 }
 
-void Scrabble::readInBoard(std::ifstream &SavedGameFile, BoardGrid *boardGrid, int boardSize) {
+void Scrabble::readInBoard(std::ifstream &SavedGameFile, BoardGrid *boardGrid) {
     std::string line;
 
-    for (int lineCount = 0; lineCount < 17; ++lineCount) {
+    // Two header lines, then one line per row.
+    for (int lineCount = 0; lineCount < boardGrid->size() + 2; ++lineCount) {
         std::getline(SavedGameFile, line);
 
         // Skip the first two header lines.
@@ -538,46 +544,60 @@ void Scrabble::readInBoard(std::ifstream &SavedGameFile, BoardGrid *boardGrid, i
             // contains a pipe "|".
             (*curBoardLine).pop_back();
 
-            // Fill the 2D boardGrid.
-            (*boardGrid)[lineCount - 2] = std::vector<Tile>(boardSize);
-
+            // Fill the boardGrid (its squares start off empty).
             for (std::size_t j = 0;
                  j < (*curBoardLine).size(); ++j) {
                 (*curBoardLine)[j] = (*curBoardLine)[j].substr(1, (*curBoardLine)[j].length() - 1);
                 Letter l = (*curBoardLine)[j][0];
-                Value val = l == ' ' ? -1 : this->getPointsForLetter(l);
 
-                (*boardGrid)[lineCount - 2][j] = *new Tile(l, val);
+                if (l != BoardGrid::EMPTY) {
+                    boardGrid->setTile(lineCount - 2, static_cast<int>(j),
+                                       Tile(l, this->getPointsForLetter(l)));
+                }
             }
+
+            delete curBoardLine;
         }
     }
 }
 
-void Scrabble::fillLinkedList(LinkedList<Tile> *toFill, std::string &line) {
+void Scrabble::readInPremiumSquares() {
+    std::string layoutFile =
+            "../resources/premiumsquares_" + std::to_string(board->getSize()) + ".txt";
+
+    // Boards without a layout are simply played without premium squares.
+    if (utils::doesFileExist(layoutFile)) {
+        board->setPremiumSquares(PremiumSquares::readFromFile(layoutFile));
+    }
+}
+
+void Scrabble::fillRack(Rack &toFill, const std::string &line) {
     std::vector<std::string> *savedTileBag = utils::splitString(line, ", ");
     for (auto &i: *savedTileBag) {
-        std::vector<std::string> *pair = utils::splitString(i, "-");
-        Letter l = (*pair)[0][0];
-        Value val = std::stoi((*pair)[1]);
-        toFill->add(new Tile(l, val));
-
-        delete pair;
+        // An empty hand is saved as an empty line.
+        if (!i.empty()) {
+            toFill.add(TileCodec::decode(i));
+        }
     }
+
+    delete savedTileBag;
 }
 
-Scrabble::Scrabble(const std::string &savedGamePathToConsume, int boardSize, StringVec *wordsList,
-                   bool correctFeature, bool expansionFeature) {
-    utils::fileExistsElseThrow(savedGamePathToConsume);
+void Scrabble::fillTileBag(const std::string &line) {
+    std::vector<std::string> *savedTileBag = utils::splitString(line, ", ");
+    for (auto &i: *savedTileBag) {
+        // An empty tilebag is saved as an empty line.
+        if (!i.empty()) {
+            this->tileBag->add(TileCodec::decode(i));
+        }
+    }
 
-    auto *boardGrid = new BoardGrid(boardSize);
+    delete savedTileBag;
+}
 
-    // Set fields.
-    this->tileBag = new LinkedList<Tile>();
-    this->players = new LinkedList<Player>();
-    this->wordsList = wordsList;
-    this->playerTurnsOrder = new SimpleQueue<Player>();
-    this->board = new Board(boardGrid, expansionFeature);
-    this->letterToPointsMap = new std::map<Letter, Value>();
+Scrabble::Scrabble(const std::string &savedGamePathToConsume, bool correctFeature,
+                   bool expansionFeature, std::uint64_t seed) : random(seed) {
+    utils::fileExistsElseThrow(savedGamePathToConsume);
     this->wordCorrectnessFeature = correctFeature;
 
     // Load file.
@@ -588,6 +608,66 @@ Scrabble::Scrabble(const std::string &savedGamePathToConsume, int boardSize, Str
 
 
     std::getline(SavedGameFile, line);
+
+    /*
+     * Newer saves start with optional "key=value" lines (i.e., the words list used), which can
+     * never be confused with the player count that older saves start with.
+     */
+    int boardSize = Board::STANDARD_SIZE;
+    std::size_t separator = line.find('=');
+    while (separator != std::string::npos) {
+        std::string key = line.substr(0, separator);
+
+        if (key == "lexicon") {
+            this->lexiconId = line.substr(separator + 1);
+        } else if (key == "board") {
+            std::string sizeValue = line.substr(separator + 1);
+            bool wellFormed;
+
+            try {
+                std::size_t parsed;
+                boardSize = std::stoi(sizeValue, &parsed);
+                wellFormed = parsed == sizeValue.length();
+            } catch (std::logic_error &notANumber) {
+                wellFormed = false;
+            }
+
+            if (!wellFormed) {
+                throw std::runtime_error("\"" + line + "\" is not a board size!");
+            }
+        } else if (key == "random") {
+            this->random = Random::fromString(line.substr(separator + 1));
+        }
+
+        std::getline(SavedGameFile, line);
+        separator = line.find('=');
+    }
+
+    if (!Board::isSupportedSize(boardSize)) {
+        throw std::runtime_error("A " + std::to_string(boardSize) + "x" + std::to_string(boardSize) +
+                                 " board is not supported!");
+    }
+
+    // Set fields, now that the header has been read without error.
+    this->tileBag = new TileBag();
+    this->players = new LinkedList<Player>();
+    this->playerTurnsOrder = new SimpleQueue<Player>();
+    this->letterToPointsMap = new std::map<Letter, Value>();
+
+    auto *boardGrid = new BoardGrid(boardSize);
+    this->board = new Board(boardGrid, expansionFeature);
+    readInPremiumSquares();
+
+    // Start loading the words list straight away, so that it loads while the rest is read in.
+    if (correctFeature) {
+        LexiconRegistry &registry = LexiconRegistry::getInstance();
+
+        if (this->lexiconId.empty()) {
+            this->lexiconId = registry.getDefaultLexiconId();
+        }
+        this->wordsList = registry.acquire(this->lexiconId);
+    }
+
     int numPlayers = std::stoi(line);
     // Read in the player objects.
     for (int i = 0; i < numPlayers; ++i) {
@@ -602,14 +682,15 @@ Scrabble::Scrabble(const std::string &savedGamePathToConsume, int boardSize, Str
         Value val = std::stoi((*mapping)[1]);
 
         this->letterToPointsMap->insert(std::pair<Letter, Value>(l, val));
+        delete mapping;
     }
 
     // Read in the board contents and create an object.
-    readInBoard(SavedGameFile, boardGrid, boardSize);
+    readInBoard(SavedGameFile, boardGrid);
 
     // Read in the tilebag and set up the tileBag object.
     std::getline(SavedGameFile, line);
-    fillLinkedList(this->tileBag, line);
+    fillTileBag(line);
 
     // Determine the ordering by queueing the first, second, third & fourth respectively (if applicable).
     for (int i = 0; i < numPlayers; ++i) {
@@ -637,6 +718,17 @@ void Scrabble::saveGame(Player *currPly, const std::string &filename) {
     // Needs to be saved in specific order
     std::ofstream SaveDestination(filename);
 
+    // The words list is only recorded for games that have one.
+    if (!lexiconId.empty()) {
+        SaveDestination << "lexicon=" << lexiconId << std::endl;
+    }
+    // Only boards that are not the standard size are recorded.
+    if (board->getSize() != Board::STANDARD_SIZE) {
+        SaveDestination << "board=" << board->getSize() << std::endl;
+    }
+    // The random numbers, so that the loaded game draws the same tiles as this one would have.
+    SaveDestination << "random=" << random.serialiseToString() << std::endl;
+
     SaveDestination << players->size() << std::endl;
     // Serialise all the constituent objects.
     // Serialise all player objects.
@@ -673,31 +765,26 @@ int Scrabble::getPointsForLetter(Letter letter) {
     return (*letterToPointsMap)[letter];
 }
 
-bool Scrabble::validateWords(std::vector<LinkedList<Tile> *> *words) {
-    bool validWord = true;
-
-    for (auto word: *words) {
-        std::string currWord;
+bool Scrabble::validateWords(const std::vector<LetterView> &words) {
+    // Waits for the words list to finish loading, if it has not already.
+    const Lexicon &dictionary = wordsList.get();
 
-        // Build the word first.
-        for (int i = 0; i < word->size(); ++i) {
-            currWord += word->get(i)->getLetter();
-        }
+    /*
+     * Check every word against the in-memory official_words_list.txt file version in one pass,
+     * straight off the board, rather than building and searching for each word separately. The
+     * words list matches letters in either case, so the tiles' uppercase letters are used as-is.
+     */
+    std::uint64_t invalidWords = dictionary.findInvalidWords(words);
 
-        /*
-         * Convert the word to its lowercase form, and then attempt to find the word in the
-         * in-memory official_words_list.txt file version.
-         */
-        std::string lCurrWord = utils::toLower(currWord);
-        int wordInd = utils::getIndexOfWord(wordsList, lCurrWord);
-
-        // If the word is not present in this list, then it is not a valid scrabble word.
-        if ((*wordsList)[wordInd] != lCurrWord) {
-            validWord = false;
-            // Notify the user exactly which word(s) is/are invalid.
-            std::cout << currWord << " is not a valid word!" << std::endl;
+    // Notify the user exactly which word(s) is/are invalid, in the order they were formed.
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        if ((invalidWords >> i) & 1u) {
+            for (std::size_t pos = 0; pos < words[i].length; ++pos) {
+                std::cout << words[i][pos];
+            }
+            std::cout << " is not a valid word!" << std::endl;
         }
     }
 
-    return validWord;
+    return invalidWords == 0;
 }
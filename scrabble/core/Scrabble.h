@@ -9,24 +9,30 @@
 #include <ctime>
 #include "gameboard/Board.h"
 #include "Player.h"
+#include "TileBag.h"
 #include "../utility/utils.h"
 #include "../utility/LinkedList.h"
 #include "../utility/SimpleQueue.h"
 #include "../utility/typedefs.h"
+#include "../utility/Random.h"
+#include "lexicon/LexiconHandle.h"
 
 
 class Scrabble {
 public:
-    // Constructor to create a new game.
+    /*
+     * Constructor to create a new game. Its tiles are drawn with random numbers from the given
+     * seed, so the same seed (and the same moves) will always play out the same way.
+     */
     Scrabble(LinkedList<Player> *players, Board *b, const std::string &fileToConsume,
-             StringVec *wordsList, bool correctFeature) :
-            players(players), wordsList(wordsList), board(b),
-            wordCorrectnessFeature(correctFeature) {
-        this->tileBag = new LinkedList<Tile>();
+             const LexiconHandle &wordsList, bool correctFeature, std::uint64_t seed) :
+            players(players), wordsList(wordsList), lexiconId(wordsList.getId()), board(b),
+            wordCorrectnessFeature(correctFeature), random(seed) {
+        this->tileBag = new TileBag();
         this->playerTurnsOrder = new SimpleQueue<Player>();
         this->letterToPointsMap = new std::map<Letter, Value>();
         createTileBag(fileToConsume);
-        shuffleTileBag();
+        readInPremiumSquares();
     }
 
     /*
@@ -35,14 +41,21 @@ public:
      * Handles the file IO, as the serialised game file is unique to this
      * object, and only it should be able to understand and recognise the
      * serialised game file's format.
+     *
+     * If word validation is on, the words list the game was saved with is acquired from the
+     * LexiconRegistry (or the default one, for games saved before words lists were recorded).
+     * The board is sized as recorded in the file (standard, if nothing is recorded).
+     *
+     * The game carries on drawing tiles with the random numbers it was saved with. Games saved
+     * before those were recorded draw them from the given seed instead.
      */
-    Scrabble(const std::string &savedGamePathToConsume, int boardSize, StringVec *wordsList,
-             bool correctFeature, bool expansionFeature);
+    Scrabble(const std::string &savedGamePathToConsume, bool correctFeature, bool expansionFeature,
+             std::uint64_t seed);
 
     ~Scrabble();
 
     // Returns the new tile to pass to the player.
-    Tile *replaceTile(Tile *tileToReplace);
+    Tile replaceTile(const Tile &tileToReplace);
 
     // Begins the game loop.
     void startGame(bool loadedGame);
@@ -60,8 +73,11 @@ private:
      */
     void createTileBag(const std::string &fileToConsume);
 
-    // Gets amtToGet random tiles from the tilebag, which is given to the player.
-    LinkedList<Tile> *getRandomTiles(int amtToGet);
+    // Draws amtToGet random tiles from the tilebag straight into the player's hand.
+    void dealTiles(Player *ply, int amtToGet);
+
+    // Draws a single tile, uniformly at random, from the (non-empty) tilebag.
+    Tile drawTile();
 
     // Validates the syntax of the commands.
     StringVec *validateCommandArguments(StringVec *args, Player *currPly);
@@ -73,16 +89,22 @@ private:
     Player *readInPlayer(std::ifstream &SavedGameFile);
 
     // Reads in the board information from the saved game file, and creates the object.
-    void readInBoard(std::ifstream &SavedGameFile, BoardGrid *boardGrid, int boardSize);
+    void readInBoard(std::ifstream &SavedGameFile, BoardGrid *boardGrid);
 
     /*
-     * Fills a LinkedList with Tiles from the information presented in the saved
+     * Lays out the board's premium squares from resources/premiumsquares_<size>.txt, if there is a
+     * layout for its size.
+     */
+    void readInPremiumSquares();
+
+    /*
+     * Fills a Rack with Tiles from the information presented in the saved
      * game format (i.e., A-1, K-3, L-9, etc).
      */
-    void fillLinkedList(LinkedList<Tile> *toFill, std::string &line);
+    void fillRack(Rack &toFill, const std::string &line);
 
-    // Shuffles the tile bag, so that its elements are in random order.
-    void shuffleTileBag();
+    // Fills the tilebag from the information presented in the saved game format.
+    void fillTileBag(const std::string &line);
 
     // Represents the gameplay process and its logic.
     void gameplay();
@@ -91,14 +113,14 @@ private:
     void parseCommand(Player *currPly);
 
     /*
-     * Given a list of words in the form of LinkedLists of tiles (not yet converted to a string),
-     * this algorithm will convert all the words into a string, and verify them against the
+     * Given a list of words in the form of views onto the board's letters (see
+     * Board::getNewWords()), this algorithm will verify them all at once against the
      * official_words_list.txt file (the official scrabble words provided by Ruwan). It will return
      * false if even just one of those words are invalid, and it will also handle the error feedback,
      * such that, it will alert the user that a word (or many) is/are invalid; it will detail the
      * invalid words too.
      */
-    bool validateWords(std::vector<LinkedList<Tile> *> *words);
+    bool validateWords(const std::vector<LetterView> &words);
 
     void displayRoundBeginInfo(Player *currPly);
 
@@ -119,18 +141,26 @@ private:
     // Check if the letter argument is logically valid, and within the constraints.
     static bool isLetterValid(char letter, char minValidLetter, char maxValidLetter);
 
-    LinkedList<Tile> *tileBag;
+    TileBag *tileBag;
     LinkedList<Player> *players;
     /*
-     * The official_words_list.txt file read into memory for efficiency purposes (trade-off between
-     * speed and memory, wherein we are sacrificing additional memory for additional speed).
+     * The official_words_list.txt file read into memory as a DAWG, which shares common prefixes and
+     * suffixes between words, so that it is both compact and quick to search. It may still be
+     * loading in the background until the first time a word is validated.
+     */
+    LexiconHandle wordsList;
+    /*
+     * The identifier of the words list this game is played with, which is recorded in saved games.
+     * It is kept even when word validation is off, so that saving does not lose it.
      */
-    StringVec *wordsList;
+    std::string lexiconId;
     // A Queue holding the references to the two players, emulating their order.
     SimpleQueue<Player> *playerTurnsOrder;
     Board *board;
     std::map<Letter, Value> *letterToPointsMap;
     bool wordCorrectnessFeature;
+    // This game's own source of random numbers (i.e., for drawing tiles).
+    Random random;
 };
 
 
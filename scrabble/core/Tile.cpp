@@ -1,30 +1,16 @@
 #include "Tile.h"
+#include <limits>
+#include <stdexcept>
+#include "TileCodec.h"
 
-Tile::Tile(const Tile &other) {
-    this->letter = other.getLetter();
-    this->value = other.getValue();
+Tile::Tile(Letter letter, Value val) : letter(letter), value(toStoredValue(val)) {
 }
 
-Tile::Tile(Letter letter, Value val) {
-    this->letter = letter;
-    this->value = val;
-}
-
-Tile::Tile() {
-    this->letter = ' ';
-    this->value = -1;
-}
-
-Letter Tile::getLetter() const {
-    return letter;
-}
-
-Value Tile::getValue() const {
-    return value;
+Tile::Tile() : letter(' '), value(-1) {
 }
 
 void Tile::setValue(Value newValue) {
-    this->value = newValue;
+    this->value = toStoredValue(newValue);
 }
 
 void Tile::setLetter(Letter newLetter) {
@@ -32,14 +18,19 @@ void Tile::setLetter(Letter newLetter) {
 }
 
 bool Tile::operator==(const Tile &other) const {
-    return other.letter == this->letter && other.value == this->value
-           && typeid(other) == typeid(*this);
+    return other.letter == this->letter && other.value == this->value;
 }
 
-std::string Tile::serialiseToString() {
-    std::string serialisedTile;
-    return serialisedTile.append(std::string(1, letter)).append("-").append(
-            std::to_string(value));
+std::int8_t Tile::toStoredValue(Value val) {
+    if (val < std::numeric_limits<std::int8_t>::min() ||
+        val > std::numeric_limits<std::int8_t>::max()) {
+        throw std::range_error("A tile cannot be worth " + std::to_string(val) +
+                               " points (it must be between -128 and 127)!");
+    }
+
+    return static_cast<std::int8_t>(val);
 }
 
-Tile::~Tile() = default;
+std::string Tile::serialiseToString() const {
+    return TileCodec::encode(*this);
+}
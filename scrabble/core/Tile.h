@@ -1,45 +1,62 @@
 #ifndef ASSIGN2_TILE_H
 #define ASSIGN2_TILE_H
 
-#include <typeinfo>
-#include "../contract/Serialisable.h"
+#include <cstdint>
+#include <string>
+#include <type_traits>
 
 // Define a Letter type
 typedef char Letter;
 // Define a Value type
 typedef int Value;
 
-class Tile : public Serialisable {
+/*
+ * A tile, packed into two bytes: its letter and its value (which must fit in a signed byte).
+ *
+ * Tiles are plain values without a base class (or the virtual table that would come with one),
+ * so they are copied as raw bytes, and arrays of them can be compared and hashed as such. Reading
+ * and writing their saved form is left to the TileCodec.
+ */
+class Tile {
 public:
     /*
-     * We do not need a move constructor for this class, since the fields are all
-     * primitive. A copy will be just as efficient.
+     * Creates a tile worth val points, which must fit in a signed byte (-128 to 127).
+     *
+     * Throws a range error if it does not, rather than silently wrapping it around.
      */
-    Tile(const Tile &other);
-
     Tile(Letter letter, Value val);
 
+    // Creates a dummy tile (as found on an empty square), with a value of -1.
     Tile();
 
-    ~Tile() override;
-
-    Letter getLetter() const;
+    Letter getLetter() const {
+        return letter;
+    }
 
     void setLetter(Letter newLetter);
 
-    Value getValue() const;
+    Value getValue() const {
+        return value;
+    }
 
+    // As with the constructor, throws a range error if the value does not fit in a signed byte.
     void setValue(Value newValue);
 
-    // Serialise object to its string representation.
-    std::string serialiseToString() override;
+    // Serialise object to its string representation (see TileCodec).
+    std::string serialiseToString() const;
 
     // Overload equality operator to check if fields are equivalent.
     bool operator==(const Tile &other) const;
 
 private:
-    Letter letter{};
-    Value value{};
+    // Returns the value as stored, after checking that it fits.
+    static std::int8_t toStoredValue(Value val);
+
+    Letter letter;
+    std::int8_t value;
 };
 
+static_assert(std::is_trivially_copyable<Tile>::value && sizeof(Tile) == 2,
+              "tiles must stay two plain bytes");
+
 #endif // ASSIGN2_TILE_H
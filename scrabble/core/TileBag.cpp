@@ -0,0 +1,97 @@
+#include "TileBag.h"
+#include <stdexcept>
+#include "TileCodec.h"
+
+// Pre-C++17, static constants that are bound to references still need a definition.
+const int TileBag::LETTERS;
+
+// The largest power of two that is no more than LETTERS, where the tree search starts from.
+static const int TREE_TOP_STEP = 16;
+
+TileBag::TileBag() : counts(), values(), tree(), total(0) {
+    for (Value &value: values) {
+        value = -1;
+    }
+}
+
+TileBag::~TileBag() = default;
+
+void TileBag::add(const Tile &tile, int count) {
+    int letterIndex = letterIndexOf(tile.getLetter());
+
+    values[letterIndex] = tile.getValue();
+    updateCount(letterIndex, count);
+}
+
+Tile TileBag::drawAt(int position) {
+    if (position < 0 || position >= total) {
+        throw std::out_of_range("There is no tile at position " + std::to_string(position) +
+                                " of the tile bag!");
+    }
+
+    /*
+     * Walk down the tree to the last node whose letters all come before the position, skipping
+     * over as many tiles as possible each step. The letter after that node holds the tile.
+     */
+    int node = 0;
+    int remaining = position;
+
+    for (int step = TREE_TOP_STEP; step > 0; step >>= 1) {
+        if (node + step <= LETTERS && tree[node + step] <= remaining) {
+            node += step;
+            remaining -= tree[node];
+        }
+    }
+
+    updateCount(node, -1);
+
+    return Tile(static_cast<Letter>('A' + node), values[node]);
+}
+
+int TileBag::size() const {
+    return total;
+}
+
+bool TileBag::isEmpty() const {
+    return total == 0;
+}
+
+int TileBag::getCount(Letter letter) const {
+    return letter >= 'A' && letter <= 'Z' ? counts[letter - 'A'] : 0;
+}
+
+std::string TileBag::serialiseToString() {
+    std::string serialisedTileBag;
+
+    for (int i = 0; i < LETTERS; ++i) {
+        std::string serialisedTile =
+                TileCodec::encode(Tile(static_cast<Letter>('A' + i), values[i]));
+
+        for (int j = 0; j < counts[i]; ++j) {
+            if (!serialisedTileBag.empty()) {
+                serialisedTileBag.append(", ");
+            }
+            serialisedTileBag.append(serialisedTile);
+        }
+    }
+
+    return serialisedTileBag;
+}
+
+int TileBag::letterIndexOf(Letter letter) {
+    if (letter < 'A' || letter > 'Z') {
+        throw std::runtime_error("A tile's letter must be between A-Z, not '" +
+                                 std::string(1, letter) + "'!");
+    }
+
+    return letter - 'A';
+}
+
+void TileBag::updateCount(int letterIndex, int delta) {
+    counts[letterIndex] += delta;
+    total += delta;
+
+    for (int node = letterIndex + 1; node <= LETTERS; node += node & -node) {
+        tree[node] += delta;
+    }
+}
@@ -0,0 +1,67 @@
+#ifndef ASSIGNMENT_2_NEW_TILEBAG_H
+#define ASSIGNMENT_2_NEW_TILEBAG_H
+
+#include "Tile.h"
+#include "../contract/Serialisable.h"
+
+/*
+ * The bag of tiles still to be drawn, stored as a count per letter rather than as the tiles
+ * themselves, since tiles of the same letter are interchangeable.
+ *
+ * The counts are also kept in a Fenwick (binary indexed) tree, so that the tile at any position
+ * (with the tiles lined up by letter) is found in O(log 26) steps, without walking every letter.
+ * Drawing the tile at a uniformly random position is then a uniformly random draw, weighted by
+ * how many of each letter are left. Nothing is allocated when tiles are drawn or returned.
+ */
+class TileBag : public Serialisable {
+public:
+    // The number of letters ('A' to 'Z') that tiles can have.
+    static const int LETTERS = 26;
+
+    // Creates an empty bag.
+    TileBag();
+
+    ~TileBag() override;
+
+    // Puts count tiles of the tile's letter (worth the tile's value) into the bag.
+    void add(const Tile &tile, int count = 1);
+
+    /*
+     * Takes the tile at a position (from 0 to size() - 1) out of the bag, where the tiles are
+     * lined up by letter.
+     */
+    Tile drawAt(int position);
+
+    // Returns the number of tiles in the bag.
+    int size() const;
+
+    bool isEmpty() const;
+
+    /*
+     * Returns the number of tiles of a letter in the bag. The tiles of a letter that a player
+     * cannot see are those in the bag plus those in the other players' hands.
+     */
+    int getCount(Letter letter) const;
+
+    /*
+     * Serialises the bag into the same form as a list of tiles (i.e., A-1, A-1, B-3), with the
+     * tiles in letter order.
+     */
+    std::string serialiseToString() override;
+
+private:
+    // Returns the index (from 0) of a tile's letter, throwing if it is not a letter.
+    static int letterIndexOf(Letter letter);
+
+    // Adds delta to a letter's count, in both the counts and the tree.
+    void updateCount(int letterIndex, int delta);
+
+    int counts[LETTERS];
+    // The value of each letter's tiles, or -1 if none have been added.
+    Value values[LETTERS];
+    // The Fenwick tree over counts, indexed from 1 (node i covers the letters (i - (i & -i), i]).
+    int tree[LETTERS + 1];
+    int total;
+};
+
+#endif //ASSIGNMENT_2_NEW_TILEBAG_H
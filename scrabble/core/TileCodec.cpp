@@ -0,0 +1,28 @@
+#include "TileCodec.h"
+#include <stdexcept>
+
+std::string TileCodec::encode(const Tile &tile) {
+    std::string encodedTile;
+    return encodedTile.append(std::string(1, tile.getLetter())).append("-").append(
+            std::to_string(tile.getValue()));
+}
+
+Tile TileCodec::decode(const std::string &encodedTile) {
+    // The letter comes first, so that the value may be negative (i.e., a dummy tile).
+    bool wellFormed = encodedTile.length() >= 3 && encodedTile[1] == '-';
+    Value value = 0;
+
+    if (wellFormed) {
+        try {
+            value = std::stoi(encodedTile.substr(2));
+        } catch (std::logic_error &notANumber) {
+            wellFormed = false;
+        }
+    }
+
+    if (!wellFormed) {
+        throw std::runtime_error("\"" + encodedTile + "\" is not a tile!");
+    }
+
+    return Tile(encodedTile[0], value);
+}
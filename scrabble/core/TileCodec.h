@@ -0,0 +1,20 @@
+#ifndef ASSIGNMENT_2_NEW_TILECODEC_H
+#define ASSIGNMENT_2_NEW_TILECODEC_H
+
+#include <string>
+#include "Tile.h"
+
+/*
+ * Converts tiles to and from their saved form, which is their letter and value separated by a
+ * dash (i.e., A-1 or Q-10). Lists of tiles (hands and the tilebag) are saved as these, separated
+ * by ", ".
+ */
+class TileCodec {
+public:
+    static std::string encode(const Tile &tile);
+
+    // Throws a runtime error if the encoded tile is malformed.
+    static Tile decode(const std::string &encodedTile);
+};
+
+#endif //ASSIGNMENT_2_NEW_TILECODEC_H
@@ -0,0 +1,168 @@
+#include "Bitboard.h"
+#include <stdexcept>
+#include <string>
+#include "BoardSizes.h"
+
+// Pre-C++17, static constants that are bound to references still need a definition.
+const int Bitboard::MAX_SIZE;
+
+Bitboard::Bitboard(int sizeDim) : dimension(sizeDim), rows() {
+    if (sizeDim < 0 || sizeDim > MAX_SIZE) {
+        throw std::invalid_argument("A board can be at most " + std::to_string(MAX_SIZE) +
+                                    " squares wide!");
+    }
+}
+
+int Bitboard::size() const {
+    return dimension;
+}
+
+bool Bitboard::test(int row, int col) const {
+    return ((rows[row] >> col) & 1u) != 0;
+}
+
+void Bitboard::set(int row, int col) {
+    rows[row] |= LineMask(1) << col;
+}
+
+void Bitboard::reset(int row, int col) {
+    rows[row] &= ~(LineMask(1) << col);
+}
+
+LineMask Bitboard::getRow(int row) const {
+    return rows[row];
+}
+
+bool Bitboard::none() const {
+    LineMask any = 0;
+
+    for (int i = 0; i < dimension; ++i) {
+        any |= rows[i];
+    }
+
+    return any == 0;
+}
+
+int Bitboard::count() const {
+    int total = 0;
+
+    for (int i = 0; i < dimension; ++i) {
+        // Clear the lowest set bit until there are none left.
+        for (LineMask lane = rows[i]; lane != 0; lane &= lane - 1) {
+            ++total;
+        }
+    }
+
+    return total;
+}
+
+bool Bitboard::hasNeighbour(int row, int col) const {
+    // Shifting past either end of the lane drops the out of bounds neighbour by itself.
+    LineMask beside = (LineMask(1) << col << 1) | (LineMask(1) << col >> 1);
+    LineMask square = LineMask(1) << col;
+
+    bool above = row > 0 && (rows[row - 1] & square) != 0;
+    bool below = row < dimension - 1 && (rows[row + 1] & square) != 0;
+
+    return (rows[row] & beside) != 0 || above || below;
+}
+
+template<int Size>
+Bitboard Bitboard::neighboursOfSize() const {
+    static_assert(Size > 1 && Size < MAX_SIZE, "The size must leave the top bit of a lane clear.");
+    const LineMask full = (LineMask(1) << Size) - 1;
+    Bitboard result(Size);
+
+    result.rows[0] = ((rows[0] << 1) | (rows[0] >> 1) | rows[1]) & full;
+    for (int i = 1; i < Size - 1; ++i) {
+        result.rows[i] = ((rows[i] << 1) | (rows[i] >> 1) | rows[i - 1] | rows[i + 1]) & full;
+    }
+    result.rows[Size - 1] =
+            ((rows[Size - 1] << 1) | (rows[Size - 1] >> 1) | rows[Size - 2]) & full;
+
+    return result;
+}
+
+Bitboard Bitboard::neighbours() const {
+    Bitboard result(dimension);
+
+    if (dimension == STANDARD_BOARD_SIZE) {
+        result = neighboursOfSize<STANDARD_BOARD_SIZE>();
+    } else if (dimension == SUPER_BOARD_SIZE) {
+        result = neighboursOfSize<SUPER_BOARD_SIZE>();
+    } else {
+        LineMask full = fullLane();
+
+        for (int i = 0; i < dimension; ++i) {
+            LineMask above = i > 0 ? rows[i - 1] : 0;
+            LineMask below = i < dimension - 1 ? rows[i + 1] : 0;
+
+            result.rows[i] = ((rows[i] << 1) | (rows[i] >> 1) | above | below) & full;
+        }
+    }
+
+    return result;
+}
+
+Bitboard Bitboard::transposed() const {
+    Bitboard result(dimension);
+
+    for (int i = 0; i < dimension; ++i) {
+        // Only visit the set squares of each row.
+        for (LineMask lane = rows[i]; lane != 0; lane &= lane - 1) {
+            int col = 0;
+            while (((lane >> col) & 1u) == 0) {
+                ++col;
+            }
+            result.rows[col] |= LineMask(1) << i;
+        }
+    }
+
+    return result;
+}
+
+Bitboard Bitboard::operator&(const Bitboard &other) const {
+    Bitboard result(dimension);
+
+    for (int i = 0; i < dimension; ++i) {
+        result.rows[i] = rows[i] & other.rows[i];
+    }
+
+    return result;
+}
+
+Bitboard Bitboard::operator|(const Bitboard &other) const {
+    Bitboard result(dimension);
+
+    for (int i = 0; i < dimension; ++i) {
+        result.rows[i] = rows[i] | other.rows[i];
+    }
+
+    return result;
+}
+
+Bitboard Bitboard::operator~() const {
+    Bitboard result(dimension);
+    LineMask full = fullLane();
+
+    for (int i = 0; i < dimension; ++i) {
+        result.rows[i] = ~rows[i] & full;
+    }
+
+    return result;
+}
+
+bool Bitboard::operator==(const Bitboard &other) const {
+    bool equal = dimension == other.dimension;
+
+    for (int i = 0; i < dimension && equal; ++i) {
+        equal = rows[i] == other.rows[i];
+    }
+
+    return equal;
+}
+
+LineMask Bitboard::fullLane() const {
+    // Shifting a 32-bit value by 32 is undefined, so a full width lane is special-cased.
+    return dimension == MAX_SIZE ? ~LineMask(0) : (LineMask(1) << dimension) - 1;
+}
@@ -0,0 +1,85 @@
+#ifndef ASSIGNMENT_2_NEW_BITBOARD_H
+#define ASSIGNMENT_2_NEW_BITBOARD_H
+
+#include <cstdint>
+
+// One bit per square of a row (bit n for column n) or of a column (bit n for row n).
+typedef std::uint32_t LineMask;
+
+/*
+ * A set of squares on a (square) board, stored as one bit per square. Each row gets its own
+ * 32-bit lane, so moving every square one column across is a shift within each lane, and moving
+ * every square one row up or down is just reading the neighbouring lane. Whole-board questions,
+ * such as "which squares touch a tile?", therefore take a few word-wide operations per row
+ * rather than a handful of reads per square.
+ *
+ * Bitboards are small values (with a fixed capacity of MAX_SIZE x MAX_SIZE), so they are freely
+ * copied. Bits outside of size() x size() are always kept clear.
+ */
+class Bitboard {
+public:
+    // The most rows (or columns) a bitboard can have, which is one per bit of a lane.
+    static const int MAX_SIZE = 32;
+
+    // Creates an empty bitboard of sizeDim x sizeDim squares (at most MAX_SIZE).
+    explicit Bitboard(int sizeDim = 0);
+
+    int size() const;
+
+    bool test(int row, int col) const;
+
+    void set(int row, int col);
+
+    void reset(int row, int col);
+
+    // Returns the squares of a row, with bit n set for column n.
+    LineMask getRow(int row) const;
+
+    // Returns whether no square is set.
+    bool none() const;
+
+    // Returns the number of set squares.
+    int count() const;
+
+    /*
+     * Returns whether any of the (up to four) squares next to the given one is set. This is the
+     * single square version of neighbours(), and only looks at the three lanes involved.
+     */
+    bool hasNeighbour(int row, int col) const;
+
+    /*
+     * Returns every square that is next to (horizontally or vertically) a set square. The
+     * standard and Super Scrabble board sizes get their own copy of the loop, with the size fixed
+     * at compile time.
+     */
+    Bitboard neighbours() const;
+
+    // Returns the bitboard flipped over its main diagonal, so that its columns become rows.
+    Bitboard transposed() const;
+
+    Bitboard operator&(const Bitboard &other) const;
+
+    Bitboard operator|(const Bitboard &other) const;
+
+    // Returns every square (within the board) that is not set.
+    Bitboard operator~() const;
+
+    bool operator==(const Bitboard &other) const;
+
+private:
+    // Returns a lane with the first size() bits set.
+    LineMask fullLane() const;
+
+    /*
+     * neighbours() for a bitboard that is known to be Size squares wide, so that the first and
+     * last rows need no checks inside the loop, the lane mask is a constant and the loop can be
+     * fully unrolled.
+     */
+    template<int Size>
+    Bitboard neighboursOfSize() const;
+
+    int dimension;
+    LineMask rows[MAX_SIZE];
+};
+
+#endif //ASSIGNMENT_2_NEW_BITBOARD_H
@@ -1,35 +1,99 @@
 #include "Board.h"
+#include <algorithm>
+#include <stdexcept>
+
+// Pre-C++17, static constants that are bound to references still need a definition.
+const int Board::STANDARD_SIZE;
+const int Board::SUPER_SIZE;
+
+bool Board::isSupportedSize(int sizeDim) {
+    return sizeDim == STANDARD_SIZE || sizeDim == SUPER_SIZE;
+}
 
 Board::~Board() {
-    // Loop through all the Tile objects and destroy them.
-    for (std::size_t i = 0; i < boardGrid->size(); ++i) {
-        for (std::size_t j = 0; j < boardGrid->size(); ++j) {
-            // Destroy tile objects.
-            delete &(*boardGrid)[i][j];
+    delete bgTraverser;
+    delete wordsPlaced;
+    delete boardGrid;
+}
+
+bool Board::isBoardEmpty() {
+    // The grid keeps a live count of its tiles.
+    return boardGrid->getTileCount() == 0;
+}
+
+int Board::getSize() const {
+    return size;
+}
+
+void Board::placeTile(const Tile &tileToPlace, char row, int column) {
+    // Transform the coordinates into accessible ints for the board grid.
+    std::pair<int, int> rowCol = logicalCoordsToIndexes(row, column);
+    this->boardGrid->setTile(rowCol.first, rowCol.second, tileToPlace);
+    updateCrossChecks(rowCol.first, rowCol.second);
+
+    if (movesApplied == 0 || canRedoMove()) {
+        beginMove();
+    }
+    journal.push_back({static_cast<std::uint8_t>(rowCol.first),
+                       static_cast<std::uint8_t>(rowCol.second), tileToPlace.getLetter(),
+                       tileToPlace.getValue()});
+}
+
+void Board::beginMove() {
+    // Forget the undone moves, which are all at the end.
+    if (canRedoMove()) {
+        journal.resize(moveStarts[movesApplied]);
+        moveStarts.resize(movesApplied);
+    }
+
+    moveStarts.push_back(journal.size());
+    ++movesApplied;
+}
+
+bool Board::undoMove() {
+    bool undone = movesApplied > 0;
+
+    if (undone) {
+        --movesApplied;
+
+        // Take the tiles off in the opposite order to which they were placed.
+        for (std::size_t i = getMoveEnd(movesApplied); i > moveStarts[movesApplied]; --i) {
+            const Placement &placement = journal[i - 1];
+            boardGrid->clearSquare(placement.row, placement.col);
+            updateCrossChecks(placement.row, placement.col);
         }
-        // Destroy inner vector housing the Tile objects.
-        delete &(*boardGrid)[i];
     }
+
+    return undone;
 }
 
-bool Board::isBoardEmpty() {
-    bool empty = true;
+bool Board::redoMove() {
+    bool redone = canRedoMove();
 
-    for (std::size_t i = 0; i < boardGrid->size(); ++i) {
-        for (std::size_t j = 0; j < boardGrid->size(); ++j) {
-            if ((*boardGrid)[i][j].getLetter() != ' ') {
-                empty = false;
-            }
+    if (redone) {
+        for (std::size_t i = moveStarts[movesApplied]; i < getMoveEnd(movesApplied); ++i) {
+            const Placement &placement = journal[i];
+            boardGrid->setTile(placement.row, placement.col,
+                               Tile(placement.letter, placement.value));
+            updateCrossChecks(placement.row, placement.col);
         }
+
+        ++movesApplied;
     }
 
-    return empty;
+    return redone;
 }
 
-void Board::placeTile(const Tile &tileToPlace, char row, int column) {
-    // Transform the coordinates into accessible ints for the board grid.
-    std::pair<int, int> rowCol = logicalCoordsToIndexes(row, column);
-    (*this->boardGrid)[rowCol.first][rowCol.second] = tileToPlace;
+bool Board::canUndoMove() const {
+    return movesApplied > 0;
+}
+
+bool Board::canRedoMove() const {
+    return movesApplied < moveStarts.size();
+}
+
+std::size_t Board::getMoveEnd(std::size_t move) const {
+    return move + 1 < moveStarts.size() ? moveStarts[move + 1] : journal.size();
 }
 
 bool Board::isLocationFreeAndValid(char row, int column) {
@@ -40,21 +104,13 @@ bool Board::isLocationFreeAndValid(char row, int column) {
      * Check if the coordinates point to a tile whose value is -1 (the dummy
      * value indicating that the grid location is free).
      */
-    bool posAvailable = (*this->boardGrid)[rowCol.first][rowCol.second].getLetter() == ' ';
-
-    // We must not check outside the bounds of the array, or we will access a random chunk of memory.
-    int left = utils::maximum(rowCol.second - 1, 0);
-    int right = utils::minimum(rowCol.second + 1, size - 1);
-    int up = utils::maximum(rowCol.first - 1, 0);
-    int down = utils::minimum(rowCol.first + 1, size - 1);
+    bool posAvailable = this->boardGrid->isEmpty(rowCol.first, rowCol.second);
 
-    // We must also check if there are tiles around this tile (i.e., if it is connected).
-    bool leftConnection = (*this->boardGrid)[rowCol.first][left].getLetter() != ' ';
-    bool rightConnection = (*this->boardGrid)[rowCol.first][right].getLetter() != ' ';
-    bool upConnection = (*this->boardGrid)[up][rowCol.second].getLetter() != ' ';
-    bool downConnection = (*this->boardGrid)[down][rowCol.second].getLetter() != ' ';
-
-    bool isConnected = leftConnection || rightConnection || upConnection || downConnection;
+    /*
+     * We must also check if there are tiles around this tile (i.e., if it is connected). This is
+     * answered from the grid's occupancy bitboard, which handles the board's edges.
+     */
+    bool isConnected = this->boardGrid->hasNeighbour(rowCol.first, rowCol.second);
 
     return posAvailable && isConnected;
 }
@@ -127,7 +183,7 @@ void Board::display() {
             if (j == horizontalLowerBound) {
                 std::cout << std::string(1, 'A' + i) << " ";
             }
-            std::cout << "| " << (*boardGrid)[i][j].getLetter() << " ";
+            std::cout << "| " << boardGrid->getLetter(i, j) << " ";
         }
         std::cout << "|" << std::endl;
     }
@@ -169,7 +225,7 @@ std::string Board::serialiseToString() {
                 serialisedBoard.append(std::string(1, 'A' + i)).append(" ");
             }
             serialisedBoard.append("| ").append(
-                    std::string(1, (*boardGrid)[i][j].getLetter())).append(" ");
+                    std::string(1, boardGrid->getLetter(i, j))).append(" ");
         }
         serialisedBoard.append("|").append("\n");
     }
@@ -177,93 +233,145 @@ std::string Board::serialiseToString() {
     return serialisedBoard;
 }
 
-void Board::fillBoardGrid() {
-    /*
-     * Loop through the BoardGrid object and fill it with empty Tile objects
-     * (i.e., tiles with dummy values for letter and value fields).
-     */
-    for (std::size_t i = 0; i < boardGrid->size(); ++i) {
-        (*boardGrid)[i] = std::vector<Tile>(size);
-        for (std::size_t j = 0; j < (*boardGrid)[0].size(); ++j) {
-            (*boardGrid)[i][j] = *new Tile();
+StringVec *Board::getWordsPlaced() {
+    return this->wordsPlaced;
+}
+
+void Board::findNewRuns(const std::vector<std::pair<int, int> > &placedSquares,
+                        std::vector<Run> &verticalRuns, std::vector<Run> &horizontalRuns) const {
+    for (auto &square: placedSquares) {
+        int start;
+        int end;
+
+        // Walk up and down from the square to the first gap (or edge) either side...
+        findRun(Direction::VERTICAL, square.second, square.first, start, end);
+        if (end > start) {
+            verticalRuns.push_back({square.second, start, end - start + 1});
+        }
+
+        // ...then left and right.
+        findRun(Direction::HORIZONTAL, square.first, square.second, start, end);
+        if (end > start) {
+            horizontalRuns.push_back({square.first, start, end - start + 1});
         }
     }
+
+    // Tiles placed along the same line find the same run, which must only be counted once.
+    std::sort(verticalRuns.begin(), verticalRuns.end());
+    verticalRuns.erase(std::unique(verticalRuns.begin(), verticalRuns.end()), verticalRuns.end());
+    std::sort(horizontalRuns.begin(), horizontalRuns.end());
+    horizontalRuns.erase(std::unique(horizontalRuns.begin(), horizontalRuns.end()),
+                         horizontalRuns.end());
 }
 
-StringVec *Board::getWordsPlaced() {
-    return this->wordsPlaced;
+std::vector<LetterView> Board::getNewWords(
+        const std::vector<std::pair<int, int> > &placedSquares) const {
+    std::vector<Run> verticalRuns;
+    std::vector<Run> horizontalRuns;
+    findNewRuns(placedSquares, verticalRuns, horizontalRuns);
+
+    // Both orientations are stored contiguously, so every word is a single unbroken span.
+    std::vector<LetterView> newWords;
+    newWords.reserve(verticalRuns.size() + horizontalRuns.size());
+
+    for (auto &run: verticalRuns) {
+        newWords.push_back({boardGrid->getLine(Direction::VERTICAL, run.line) + run.start,
+                            static_cast<std::size_t>(run.length), 1});
+    }
+    for (auto &run: horizontalRuns) {
+        newWords.push_back({boardGrid->getLine(Direction::HORIZONTAL, run.line) + run.start,
+                            static_cast<std::size_t>(run.length), 1});
+    }
+
+    return newWords;
 }
 
-std::vector<LinkedList<Tile> *> *Board::getAllNewWordsOnBoard(StringVec *wordsPlacedNew) {
-    auto words = std::vector<LinkedList<Tile> *>();
-    auto newWords = new std::vector<LinkedList<Tile> *>();
+void Board::setPremiumSquares(const PremiumSquares &layout) {
+    if (layout.size() != size) {
+        throw std::runtime_error("The premium squares do not fit a " + std::to_string(size) + "x" +
+                                 std::to_string(size) + " board!");
+    }
 
-    // Explore vertically first.
-    for (int col = 0; col < (*boardGrid)[0].size(); ++col) {
-        auto wordToAdd = new LinkedList<Tile>();
+    premiumSquares = layout;
+}
 
-        for (int row = 0; row < boardGrid->size(); ++row) {
-            auto curr = (*boardGrid)[row][col];
-            if (curr.getLetter() != ' ') {
-                wordToAdd->add(new Tile(curr));
-            }
-        }
+const PremiumSquares &Board::getPremiumSquares() const {
+    return premiumSquares;
+}
 
-        if (wordToAdd->size() <= 1) {
-            delete wordToAdd;
-        } else {
-            words.push_back(wordToAdd);
-        }
+int Board::scoreMove(const std::vector<std::pair<int, int> > &placedSquares) const {
+    // The squares covered this turn along each row, and along each column.
+    LineMask placedAlongRows[Bitboard::MAX_SIZE] = {};
+    LineMask placedAlongCols[Bitboard::MAX_SIZE] = {};
+    for (auto &square: placedSquares) {
+        placedAlongRows[square.first] |= LineMask(1) << square.second;
+        placedAlongCols[square.second] |= LineMask(1) << square.first;
     }
 
-    // Explore horizontally next.
-    for (int row = 0; row < (*boardGrid)[0].size(); ++row) {
-        auto wordToAdd = new LinkedList<Tile>();
+    int score = 0;
 
-        for (int col = 0; col < boardGrid->size(); ++col) {
-            auto curr = (*boardGrid)[row][col];
-            if (curr.getLetter() != ' ') {
-                wordToAdd->add(new Tile(curr));
-            }
-        }
+    for (auto &square: placedSquares) {
+        score += scoreNewRun(Direction::VERTICAL, square.second, square.first,
+                             placedAlongCols[square.second]);
+        score += scoreNewRun(Direction::HORIZONTAL, square.first, square.second,
+                             placedAlongRows[square.first]);
+    }
 
-        if (wordToAdd->size() <= 1) {
-            delete wordToAdd;
-        } else {
-            words.push_back(wordToAdd);
-        }
+    return score;
+}
+
+int Board::scoreNewRun(Direction direction, int line, int pos, LineMask placedAlongLine) const {
+    int start;
+    int end;
+    findRun(direction, line, pos, start, end);
+
+    // Tiles placed along the same line find the same run, so it is only scored from the first.
+    LineMask placedBefore = placedAlongLine & ((LineMask(1) << pos) - (LineMask(1) << start));
+    int score = 0;
+
+    if (end > start && placedBefore == 0) {
+        score = scoreRun(direction, {line, start, end - start + 1}, placedAlongLine);
     }
 
+    return score;
+}
 
-    for (auto word: words) {
-        std::string currWord;
+int Board::scoreRun(Direction direction, const Run &run, LineMask newlyCovered) const {
+    const Letter *letters = boardGrid->getLine(direction, run.line);
+    const std::uint8_t *letterMultipliers = premiumSquares.getLetterMultipliers();
+    const std::uint8_t *wordMultipliers = premiumSquares.getWordMultipliers();
+    int wordScore = 0;
+    int wordMultiplier = 1;
+
+    for (int pos = run.start; pos < run.start + run.length; ++pos) {
+        int square = squareIndex(direction, run.line, pos);
+        // 1 if the square was covered this turn (so its premiums count), otherwise 0.
+        int isNew = static_cast<int>((newlyCovered >> pos) & 1u);
+
+        wordScore += boardGrid->getValueOf(letters[pos]) *
+                     (1 + isNew * (letterMultipliers[square] - 1));
+        wordMultiplier *= 1 + isNew * (wordMultipliers[square] - 1);
+    }
 
-        // Build the word first.
-        for (int i = 0; i < word->size(); ++i) {
-            currWord += word->get(i)->getLetter();
-        }
+    return wordScore * wordMultiplier;
+}
 
-        wordsPlacedNew->push_back(currWord);
-        bool newWord = true;
-
-        /*
-         * I am aware that the downfall to this method is duplicate words, and I would fix it if
-         * I had time, however, time is not on my side right now, and this is the best I could do
-         * given my circumstances.
-         */
-        for (auto &i: *wordsPlaced) {
-            if (i == currWord) {
-                newWord = false;
-            }
-        }
+int Board::squareIndex(Direction direction, int line, int pos) const {
+    return direction == Direction::HORIZONTAL ? line * size + pos : pos * size + line;
+}
 
-        // Add it to the new words list.
-        if (newWord) {
-            newWords->push_back(word);
-        }
+void Board::findRun(Direction direction, int line, int pos, int &start, int &end) const {
+    LineMask occupied = boardGrid->getLineMask(direction, line);
+
+    start = pos;
+    while (start > 0 && ((occupied >> (start - 1)) & 1u) != 0) {
+        --start;
     }
 
-    return newWords;
+    end = pos;
+    while (end < size - 1 && ((occupied >> (end + 1)) & 1u) != 0) {
+        ++end;
+    }
 }
 
 void Board::setWordsPlaced(StringVec *newWordsPlaced) {
@@ -271,7 +379,94 @@ void Board::setWordsPlaced(StringVec *newWordsPlaced) {
     this->wordsPlaced = newWordsPlaced;
 }
 
+void Board::addWordsPlaced(const StringVec &newWords) {
+    wordsPlaced->insert(wordsPlaced->end(), newWords.begin(), newWords.end());
+}
+
 void Board::removeTile(char row, int col) {
     std::pair<int, int> rowCol = logicalCoordsToIndexes(row, col);
-    (*boardGrid)[rowCol.first][rowCol.second] = Tile();
+    boardGrid->clearSquare(rowCol.first, rowCol.second);
+    updateCrossChecks(rowCol.first, rowCol.second);
+}
+
+const BoardGrid *Board::getBoardGrid() const {
+    return boardGrid;
+}
+
+void Board::setLexicon(const Lexicon *newLexicon) {
+    lexicon = newLexicon;
+    horizontalCrossChecks.assign(size * size, ANY_LETTER);
+    verticalCrossChecks.assign(size * size, ANY_LETTER);
+
+    if (lexicon != nullptr) {
+        for (int line = 0; line < size; ++line) {
+            for (int pos = 0; pos < size; ++pos) {
+                horizontalCrossChecks[squareIndex(Direction::HORIZONTAL, line, pos)] =
+                        computeCrossCheck(Direction::HORIZONTAL, line, pos);
+                verticalCrossChecks[squareIndex(Direction::VERTICAL, line, pos)] =
+                        computeCrossCheck(Direction::VERTICAL, line, pos);
+            }
+        }
+    }
+}
+
+LetterMask Board::getCrossCheck(int row, int col, Direction direction) const {
+    LetterMask check = ANY_LETTER;
+
+    if (lexicon != nullptr) {
+        check = direction == Direction::HORIZONTAL ? horizontalCrossChecks[row * size + col]
+                                                   : verticalCrossChecks[row * size + col];
+    }
+
+    return check;
+}
+
+LetterMask Board::computeCrossCheck(Direction direction, int line, int pos) const {
+    const Letter *letters = boardGrid->getLine(direction, line);
+    LetterMask check = 0;
+
+    if (letters[pos] == BoardGrid::EMPTY) {
+        int start;
+        int end;
+        findRun(direction, line, pos, start, end);
+
+        if (start == end) {
+            // No tiles either side, so nothing constrains the square.
+            check = ANY_LETTER;
+        } else {
+            // Read both runs of tiles straight off the board.
+            LetterView before = {letters + start, static_cast<std::size_t>(pos - start), 1};
+            LetterView after = {letters + pos + 1, static_cast<std::size_t>(end - pos), 1};
+
+            check = lexicon->findFillers(before, after);
+        }
+    }
+
+    return check;
+}
+
+void Board::updateCrossChecks(int row, int col) {
+    if (lexicon != nullptr) {
+        for (Direction direction: {Direction::HORIZONTAL, Direction::VERTICAL}) {
+            std::vector<LetterMask> &checks =
+                    direction == Direction::HORIZONTAL ? horizontalCrossChecks : verticalCrossChecks;
+            int line = direction == Direction::HORIZONTAL ? row : col;
+            int pos = direction == Direction::HORIZONTAL ? col : row;
+
+            /*
+             * The squares just past the tiles either side of the changed square are the only
+             * empty squares whose words ran through it.
+             */
+            int start;
+            int end;
+            findRun(direction, line, pos, start, end);
+
+            for (int affected: {start - 1, pos, end + 1}) {
+                if (affected >= 0 && affected < size) {
+                    checks[squareIndex(direction, line, affected)] =
+                            computeCrossCheck(direction, line, affected);
+                }
+            }
+        }
+    }
 }
@@ -1,17 +1,30 @@
 #ifndef ASSIGNMENT_2_BOARD_H
 #define ASSIGNMENT_2_BOARD_H
 
+#include <cstdint>
 #include <fstream>
 #include <utility>
 #include "../Tile.h"
-#include "../../utility/LinkedList.h"
+#include "../../contract/Serialisable.h"
+#include "BoardGrid.h"
 #include "BoardGridTraverser.h"
+#include "BoardSizes.h"
+#include "PremiumSquares.h"
 #include "../../utility/typedefs.h"
 #include "../../utility/utils.h"
+#include "../lexicon/Lexicon.h"
 
 
 class Board : public Serialisable {
 public:
+    // The number of rows (and columns) of a standard board.
+    static const int STANDARD_SIZE = STANDARD_BOARD_SIZE;
+    // The number of rows (and columns) of a Super Scrabble board.
+    static const int SUPER_SIZE = SUPER_BOARD_SIZE;
+
+    // Returns whether a board of sizeDim x sizeDim squares can be played on.
+    static bool isSupportedSize(int sizeDim);
+
     /*
      * Member Initialiser List is both slightly more efficient, and it allows
      * omitting the default constructor specification (less verbose).
@@ -19,12 +32,13 @@ public:
      * Create a new Board object with a given sizeDim for the boardGrid.
      */
     Board(int sizeDim, bool expansionFeature) : size(sizeDim),
-                                                boardExpansionFeature(expansionFeature) {
+                                                boardExpansionFeature(expansionFeature),
+                                                premiumSquares(sizeDim) {
         boardGrid = new BoardGrid(size);
         wordsPlaced = new StringVec();
         bgTraverser = new BoardGridTraverser(boardGrid);
-
-        fillBoardGrid();
+        lexicon = nullptr;
+        movesApplied = 0;
     };
 
     /*
@@ -36,7 +50,7 @@ public:
      */
     Board(BoardGrid *board, bool expansionFeature)
             : size(board->size()), boardExpansionFeature(expansionFeature), wordsPlaced(),
-              boardGrid(board) {
+              boardGrid(board), lexicon(nullptr), premiumSquares(board->size()), movesApplied(0) {
         bgTraverser = new BoardGridTraverser(board);
     };
 
@@ -49,25 +63,90 @@ public:
     /*
      * Places a given tile, at a certain row and column number, irrespective of its validity.
      * isLocationFreeAndValid() should be used prior to this method to ensure the validity of placement.
+     *
+     * The placement is recorded in the journal, as part of the current move (see beginMove()). A
+     * move is begun first if none has been, or if there are undone moves (which are forgotten).
      */
     void placeTile(const Tile &tileToPlace, char row, int column);
 
+    /*
+     * The board keeps a journal of the tiles placed, grouped into moves, so that whole moves can
+     * be taken back off the board and put back again. Only the squares (and what is worked out
+     * from them, i.e., the tile count, bounds, occupancy and cross-checks) are journalled, not
+     * the words placed. Undoing or redoing a move takes time proportional to its tiles.
+     *
+     * Starts a new (empty) move, which later placements are recorded as part of. Any undone moves
+     * can no longer be redone.
+     */
+    void beginMove();
+
+    // Takes the tiles of the last move back off the board. Returns false if there is no move.
+    bool undoMove();
+
+    // Puts the tiles of the last undone move back on the board. Returns false if there is none.
+    bool redoMove();
+
+    bool canUndoMove() const;
+
+    bool canRedoMove() const;
+
     /*
      * Displays the layout of the grid and its contents to standard output.
      */
     void display();
 
+    /*
+     * Returns every word formed so far in the game, in the order they were formed. This is only
+     * a record (i.e., for saved games); new words are found from the tiles placed instead.
+     */
     StringVec *getWordsPlaced();
 
+    // Removes a tile from the board, without recording it in the journal.
     void removeTile(char row, int col);
 
     void setWordsPlaced(StringVec *newWordsPlaced);
 
+    // Appends the words formed by a move to the words placed so far.
+    void addWordsPlaced(const StringVec &newWords);
+
     bool isBoardEmpty();
 
+    // Returns the number of rows (which is also the number of columns).
+    int getSize() const;
+
     bool isLocationFreeAndValid(char row, int column);
 
-    std::vector<LinkedList<Tile> *> *getAllNewWordsOnBoard(StringVec *wordsPlacedNew);
+    /*
+     * Finds the words formed by the tiles placed this turn (given as row and column indexes, see
+     * logicalCoordsToIndexes()). Only the lines through the placed squares are read: for each of
+     * them, the unbroken run of tiles in each direction is a word if it is at least two tiles
+     * long, so the main line and every cross line are found once each, and a gap ends a word.
+     * The work done therefore depends on the size of the move, not of the board.
+     *
+     * Vertical words are returned first (from left to right), then horizontal ones (from top to
+     * bottom). Each word is a view straight onto the board's letters (nothing is copied), so it is
+     * only valid until the board next changes.
+     */
+    std::vector<LetterView> getNewWords(const std::vector<std::pair<int, int> > &placedSquares) const;
+
+    /*
+     * Lays out the premium squares (a board starts off without any). The layout must be the same
+     * size as the board.
+     */
+    void setPremiumSquares(const PremiumSquares &layout);
+
+    const PremiumSquares &getPremiumSquares() const;
+
+    /*
+     * Scores the tiles placed this turn (given as for getNewWords()), which must already be on
+     * the board. Every word they form scores the sum of its tiles' values, with the letter
+     * multipliers of the squares covered this turn applied, and is then multiplied by the word
+     * multipliers of those squares. Squares covered in earlier turns count at face value.
+     *
+     * Multipliers are applied arithmetically (rather than branched on) from the flat premium
+     * square tables, and nothing is allocated, so that candidate moves can be scored in bulk.
+     */
+    int scoreMove(const std::vector<std::pair<int, int> > &placedSquares) const;
 
     /*
      * Serialises a given board object into its String representation.
@@ -77,17 +156,113 @@ public:
     /*
      * Converts the validated user input, which is in the form of a char and int
      * (i.e., A3, K0, L9, etc), into its integer representation, so that it
-     * is accessible by the board grid (since it is a 2D vector).
+     * is accessible by the board grid (as a row and column index).
      */
     static std::pair<int, int> logicalCoordsToIndexes(char row, int column);
 
+    // Gives read-only access to the squares (i.e., to read words straight off the board).
+    const BoardGrid *getBoardGrid() const;
+
+    /*
+     * Attaches the words list that the cross-checks (see getCrossCheck()) are worked out with,
+     * and works them out for every square. From then on, they are kept up to date as tiles are
+     * placed and removed. The lexicon must outlive the board (or be detached with nullptr).
+     *
+     * A board starts off without one, since keeping the cross-checks up to date costs a few
+     * lookups per tile placed or removed, so only attach it when analysing the board (i.e., when
+     * generating moves), not just to validate the words that players form.
+     *
+     * In particular, the game does not check the tiles players place against the cross-checks:
+     * tiles are placed one at a time, anywhere, so a tile that breaks a cross-check may still be
+     * part of a valid move once the rest of it is down. The words of a finished move are instead
+     * looked up together (see Lexicon::findInvalidWords()), which costs fewer lookups than
+     * keeping the cross-checks for every tile placed.
+     */
+    void setLexicon(const Lexicon *newLexicon);
+
+    /*
+     * Returns the cross-check of a square: the letters that could be placed on it without the
+     * word running through it in the given direction (made with the tiles directly either side
+     * of it) being invalid. Squares without tiles either side in that direction allow every
+     * letter, and occupied squares allow none. Every letter is allowed while no lexicon is
+     * attached.
+     *
+     * A letter can therefore be ruled out for a square with a single AND, rather than a lookup.
+     */
+    LetterMask getCrossCheck(int row, int col, Direction direction) const;
+
 private:
     /*
-     * Initially fills the board grid with empty tiles
-     * (i.e., tiles with a dummy letter and value). These are then to be replaced
-     * later on during the gameplay. Called during the construction of a Board object.
+     * The routines below work along a single line of the board in either direction, so that rows
+     * and columns share the same code. A square is given by its line (its row if horizontal, or
+     * its column if vertical) and its position along that line.
+     */
+
+    // A run of tiles along a line, identified by the line it lies on and the square it starts from.
+    struct Run {
+        int line;
+        int start;
+        int length;
+
+        bool operator<(const Run &other) const {
+            return line < other.line || (line == other.line && start < other.start);
+        }
+
+        bool operator==(const Run &other) const {
+            return line == other.line && start == other.start;
+        }
+    };
+
+    /*
+     * Finds the runs of at least two tiles through the given squares, in each direction, each
+     * found once and in order (see getNewWords()).
+     */
+    void findNewRuns(const std::vector<std::pair<int, int> > &placedSquares,
+                     std::vector<Run> &verticalRuns, std::vector<Run> &horizontalRuns) const;
+
+    /*
+     * Scores the run through a square covered this turn, given all of the squares covered this
+     * turn along its line. Returns 0 if the run is too short to be a word, or holds a square
+     * covered this turn before this one (from which it is scored instead).
+     */
+    int scoreNewRun(Direction direction, int line, int pos, LineMask placedAlongLine) const;
+
+    /*
+     * Scores a single run, given the squares covered this turn along its line (bit n for its nth
+     * square).
+     */
+    int scoreRun(Direction direction, const Run &run, LineMask newlyCovered) const;
+
+    // Returns the index (as laid out by the BoardGrid) of a square given by line and position.
+    int squareIndex(Direction direction, int line, int pos) const;
+
+    /*
+     * Finds the tiles directly either side of a position on a line (the position itself may be
+     * empty). start is set to the first of the tiles before it and end to the last of the tiles
+     * after it, so both are pos if there are none.
      */
-    void fillBoardGrid();
+    void findRun(Direction direction, int line, int pos, int &start, int &end) const;
+
+    // Works out a single square's cross-check in one direction, from scratch.
+    LetterMask computeCrossCheck(Direction direction, int line, int pos) const;
+
+    /*
+     * Brings the cross-checks up to date after the square at row, col changed. Only the square
+     * itself, and the nearest empty squares past the runs of tiles either side of it (in each
+     * direction), can have been affected.
+     */
+    void updateCrossChecks(int row, int col);
+
+    // A tile placed on the board, as recorded in the journal.
+    struct Placement {
+        std::uint8_t row;
+        std::uint8_t col;
+        Letter letter;
+        Value value;
+    };
+
+    // Returns the index just past the last placement of a move in the journal.
+    std::size_t getMoveEnd(std::size_t move) const;
 
     /*
      * Since a grid is essentially square, this variable represents the single
@@ -97,8 +272,20 @@ private:
     bool boardExpansionFeature;
     StringVec *wordsPlaced;
     BoardGridTraverser *bgTraverser;
-    // Reference to the underlying BoardGrid (2D vector) object.
+    // Reference to the underlying BoardGrid (flat array of squares) object.
     BoardGrid *boardGrid;
+    // nullptr while the cross-checks are not being kept.
+    const Lexicon *lexicon;
+    // The cross-checks of every square (laid out like the BoardGrid), in each direction.
+    std::vector<LetterMask> horizontalCrossChecks;
+    std::vector<LetterMask> verticalCrossChecks;
+    PremiumSquares premiumSquares;
+    // Every placement, in order, followed by those of any undone moves.
+    std::vector<Placement> journal;
+    // The index in the journal of the first placement of each move.
+    std::vector<std::size_t> moveStarts;
+    // The number of moves (from the start) that are currently on the board.
+    std::size_t movesApplied;
 };
 
 #endif //ASSIGNMENT_2_BOARD_H
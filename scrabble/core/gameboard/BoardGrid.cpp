@@ -0,0 +1,199 @@
+#include "BoardGrid.h"
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include "../../utility/utils.h"
+
+// Pre-C++17, static constants that are bound to references still need a definition.
+const Letter BoardGrid::EMPTY;
+const int BoardGrid::MAX_SIZE;
+
+// The size of a cache line on every platform that this is likely to run on.
+static const std::size_t CACHE_LINE_SIZE = 64;
+
+// Returns the number of set bits in a mask.
+static int countBits(LineMask mask) {
+    int count = 0;
+
+    while (mask != 0) {
+        // Clears the lowest set bit.
+        mask &= mask - 1;
+        ++count;
+    }
+
+    return count;
+}
+
+BoardGrid::BoardGrid(int sizeDim)
+        : dimension(sizeDim), cells(nullptr), transposedCells(nullptr), tileCount(0), occupied(sizeDim),
+          occupiedTransposed(sizeDim), topRow(-1), bottomRow(-1), leftColumn(-1), rightColumn(-1) {
+    // The bitboards have already rejected sizes that are too big by this point.
+    std::size_t squares = static_cast<std::size_t>(dimension) * dimension;
+    // Start the transposed copy on a fresh cache line too.
+    std::size_t paddedSquares = (squares + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+    void *memory = nullptr;
+
+    if (posix_memalign(&memory, CACHE_LINE_SIZE, paddedSquares == 0 ? 1 : 2 * paddedSquares) != 0) {
+        throw std::bad_alloc();
+    }
+
+    cells = static_cast<Letter *>(memory);
+    transposedCells = cells + paddedSquares;
+    std::memset(cells, EMPTY, 2 * paddedSquares);
+
+    for (Value &value: letterValues) {
+        value = -1;
+    }
+}
+
+BoardGrid::~BoardGrid() {
+    free(cells);
+}
+
+int BoardGrid::getTileCount() const {
+    return tileCount;
+}
+
+LineMask BoardGrid::getRowMask(int row) const {
+    return occupied.getRow(row);
+}
+
+LineMask BoardGrid::getColumnMask(int col) const {
+    return occupiedTransposed.getRow(col);
+}
+
+LineMask BoardGrid::getLineMask(Direction direction, int line) const {
+    return direction == Direction::HORIZONTAL ? getRowMask(line) : getColumnMask(line);
+}
+
+int BoardGrid::getRowCount(int row) const {
+    return countBits(occupied.getRow(row));
+}
+
+int BoardGrid::getColumnCount(int col) const {
+    return countBits(occupiedTransposed.getRow(col));
+}
+
+bool BoardGrid::hasNeighbour(int row, int col) const {
+    return occupied.hasNeighbour(row, col);
+}
+
+const Bitboard &BoardGrid::getOccupied() const {
+    return occupied;
+}
+
+const Bitboard &BoardGrid::getOccupiedTransposed() const {
+    return occupiedTransposed;
+}
+
+Bitboard BoardGrid::getAnchors() const {
+    return occupied.neighbours() & ~occupied;
+}
+
+int BoardGrid::getTopRow() const {
+    return topRow;
+}
+
+int BoardGrid::getBottomRow() const {
+    return bottomRow;
+}
+
+int BoardGrid::getLeftColumn() const {
+    return leftColumn;
+}
+
+int BoardGrid::getRightColumn() const {
+    return rightColumn;
+}
+
+Value BoardGrid::getValue(int row, int col) const {
+    return getValueOf(getLetter(row, col));
+}
+
+Value BoardGrid::getValueOf(Letter letter) const {
+    return letter >= 'A' && letter <= 'Z' ? letterValues[letter - 'A'] : -1;
+}
+
+Tile BoardGrid::getTile(int row, int col) const {
+    return isEmpty(row, col) ? Tile() : Tile(getLetter(row, col), getValue(row, col));
+}
+
+void BoardGrid::setTile(int row, int col, const Tile &tile) {
+    Letter letter = tile.getLetter();
+
+    // Setting an empty tile is a removal, which has to keep the counts and bounds in step.
+    if (letter == EMPTY) {
+        clearSquare(row, col);
+    } else {
+        // Replacing a tile does not change where the tiles are.
+        if (isEmpty(row, col)) {
+            ++tileCount;
+            occupied.set(row, col);
+            occupiedTransposed.set(col, row);
+
+            // Adding a tile can only ever grow the bounding box.
+            if (topRow == -1) {
+                topRow = bottomRow = row;
+                leftColumn = rightColumn = col;
+            } else {
+                topRow = utils::minimum(topRow, row);
+                bottomRow = utils::maximum(bottomRow, row);
+                leftColumn = utils::minimum(leftColumn, col);
+                rightColumn = utils::maximum(rightColumn, col);
+            }
+        }
+
+        cells[row * dimension + col] = letter;
+        transposedCells[col * dimension + row] = letter;
+
+        if (letter >= 'A' && letter <= 'Z') {
+            letterValues[letter - 'A'] = tile.getValue();
+        }
+    }
+}
+
+void BoardGrid::clearSquare(int row, int col) {
+    if (!isEmpty(row, col)) {
+        cells[row * dimension + col] = EMPTY;
+        transposedCells[col * dimension + row] = EMPTY;
+        --tileCount;
+        occupied.reset(row, col);
+        occupiedTransposed.reset(col, row);
+
+        // Only emptying an edge row or column of the bounding box can shrink it.
+        bool edgeEmptied = (getRowMask(row) == 0 && (row == topRow || row == bottomRow)) ||
+                           (getColumnMask(col) == 0 && (col == leftColumn || col == rightColumn));
+        if (edgeEmptied) {
+            shrinkBounds();
+        }
+    }
+}
+
+void BoardGrid::shrinkBounds() {
+    while (topRow != -1 && getRowMask(topRow) == 0) {
+        topRow = topRow == bottomRow ? -1 : topRow + 1;
+    }
+
+    // Every row being empty means that every column is too.
+    if (topRow == -1) {
+        bottomRow = leftColumn = rightColumn = -1;
+    } else {
+        while (getRowMask(bottomRow) == 0) {
+            --bottomRow;
+        }
+        while (getColumnMask(leftColumn) == 0) {
+            ++leftColumn;
+        }
+        while (getColumnMask(rightColumn) == 0) {
+            --rightColumn;
+        }
+    }
+}
+
+const Letter *BoardGrid::data() const {
+    return cells;
+}
+
+const Letter *BoardGrid::getLine(Direction direction, int line) const {
+    return (direction == Direction::HORIZONTAL ? cells : transposedCells) + line * dimension;
+}
@@ -0,0 +1,157 @@
+#ifndef ASSIGNMENT_2_NEW_BOARDGRID_H
+#define ASSIGNMENT_2_NEW_BOARDGRID_H
+
+#include "Bitboard.h"
+#include "../Tile.h"
+
+// The two directions a word (or any other line of squares) can run in.
+enum class Direction {
+    HORIZONTAL, VERTICAL
+};
+
+/*
+ * The squares of a (square) board, stored as one contiguous, cache line aligned array of letters
+ * in row-major order, one byte per square (' ' for an empty square). Tile values are not stored
+ * per square, since every tile of a letter is worth the same; they are looked up by letter
+ * instead.
+ *
+ * Keeping the letters in a single small block means that a whole-board scan is one straight pass
+ * over size() * size() bytes. A transposed copy of the letters (column-major) is written alongside
+ * them, so that every line of the board, whether a row or a column, can be read in place as one
+ * contiguous run of letters (see getLine()).
+ *
+ * The grid also keeps track of which squares are occupied (as a bitboard, plus a transposed copy
+ * so that columns can be read as lanes too), of how many tiles there are, and of the smallest box
+ * that holds every tile, as tiles are placed and removed, so that none of these need a scan to
+ * find.
+ */
+class BoardGrid {
+public:
+    // The letter stored in an empty square.
+    static const Letter EMPTY = ' ';
+    // The most rows (or columns) a grid can have.
+    static const int MAX_SIZE = Bitboard::MAX_SIZE;
+
+    // Creates a grid of sizeDim x sizeDim empty squares (at most MAX_SIZE x MAX_SIZE).
+    explicit BoardGrid(int sizeDim);
+
+    ~BoardGrid();
+
+    // The grid owns its squares, and is always shared by pointer, so it is not copied.
+    BoardGrid(const BoardGrid &other) = delete;
+
+    BoardGrid &operator=(const BoardGrid &other) = delete;
+
+    // Returns the number of rows (which is also the number of columns).
+    int size() const {
+        return dimension;
+    }
+
+    // Returns the letter on a square, or EMPTY.
+    Letter getLetter(int row, int col) const {
+        return cells[row * dimension + col];
+    }
+
+    bool isEmpty(int row, int col) const {
+        return getLetter(row, col) == EMPTY;
+    }
+
+    // Returns the number of tiles on the board.
+    int getTileCount() const;
+
+    // Returns the occupied squares of a row, with bit n set if column n holds a tile.
+    LineMask getRowMask(int row) const;
+
+    // Returns the occupied squares of a column, with bit n set if row n holds a tile.
+    LineMask getColumnMask(int col) const;
+
+    /*
+     * Returns the occupied squares of a line (a row if horizontal, otherwise a column), with bit n
+     * set if its nth square holds a tile.
+     */
+    LineMask getLineMask(Direction direction, int line) const;
+
+    // Returns the number of tiles in a row.
+    int getRowCount(int row) const;
+
+    // Returns the number of tiles in a column.
+    int getColumnCount(int col) const;
+
+    // Returns whether any of the (up to four) squares next to the given one holds a tile.
+    bool hasNeighbour(int row, int col) const;
+
+    // Returns the occupied squares.
+    const Bitboard &getOccupied() const;
+
+    // Returns the occupied squares, transposed (i.e., bit n of lane c is set if (n, c) is occupied).
+    const Bitboard &getOccupiedTransposed() const;
+
+    /*
+     * Returns the anchor squares, which are the empty squares next to a tile. Every tile placed
+     * after the first move must be connected through one of these.
+     */
+    Bitboard getAnchors() const;
+
+    /*
+     * Return the first/last row and column that hold a tile, which together bound every tile on
+     * the board. All four are -1 while the board is empty.
+     */
+    int getTopRow() const;
+
+    int getBottomRow() const;
+
+    int getLeftColumn() const;
+
+    int getRightColumn() const;
+
+    // Returns the value of the tile on a square, or -1 if it is empty.
+    Value getValue(int row, int col) const;
+
+    // Returns the value of a letter's tiles, or -1 if none have been placed.
+    Value getValueOf(Letter letter) const;
+
+    // Returns a copy of the tile on a square (a dummy tile if it is empty).
+    Tile getTile(int row, int col) const;
+
+    // Places a copy of the tile on a square, replacing whatever was there (EMPTY clears it).
+    void setTile(int row, int col, const Tile &tile);
+
+    // Removes the tile (if any) from a square.
+    void clearSquare(int row, int col);
+
+    /*
+     * Returns the letters of every square, row by row. The square at (row, col) is found at
+     * data()[row * size() + col].
+     */
+    const Letter *data() const;
+
+    /*
+     * Returns the size() contiguous letters of a line: row number line if horizontal, or column
+     * number line if vertical (read from the transposed copy).
+     */
+    const Letter *getLine(Direction direction, int line) const;
+
+private:
+    /*
+     * Recomputes the bounding box from the row and column masks, after its edge may have been
+     * emptied by a removal.
+     */
+    void shrinkBounds();
+
+    int dimension;
+    // size() * size() letters, aligned to a cache line.
+    Letter *cells;
+    // The same letters in column-major order, in the same allocation as cells (after it).
+    Letter *transposedCells;
+    // The value of each letter's tiles (indexed from 'A'), or -1 if none have been placed yet.
+    Value letterValues[26];
+    int tileCount;
+    Bitboard occupied;
+    Bitboard occupiedTransposed;
+    int topRow;
+    int bottomRow;
+    int leftColumn;
+    int rightColumn;
+};
+
+#endif //ASSIGNMENT_2_NEW_BOARDGRID_H
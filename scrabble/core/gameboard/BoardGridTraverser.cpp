@@ -5,17 +5,10 @@ BoardGridTraverser::BoardGridTraverser(BoardGrid *boardGrid) {
 }
 
 int BoardGridTraverser::getVerticalUpperBound(int padding) {
-    int upperBound = -1;
+    // The grid keeps track of its occupied rows, so nothing needs to be scanned.
+    int upperBound = boardGrid->getBottomRow();
 
-    for (int i = boardGrid->size() - 1; i >= 0; --i) {
-        for (int j = 0; j < boardGrid->size(); ++j) {
-            if ((*boardGrid)[i][j].getLetter() != ' ' && i > upperBound) {
-                upperBound = i;
-            }
-        }
-    }
-
-    // The board is empty, thus, we reached the end of the boardGrid, and must use the array boundary.
+    // The board is empty, thus, we must use the array boundary.
     if (upperBound == -1) {
         upperBound = boardGrid->size() - 1;
     } else {
@@ -26,18 +19,10 @@ int BoardGridTraverser::getVerticalUpperBound(int padding) {
 }
 
 int BoardGridTraverser::getVerticalLowerBound(int padding) {
-    int lowerBound = boardGrid->size() - 1;
-
-    for (int i = 0; i < boardGrid->size(); ++i) {
-        for (int j = 0; j < boardGrid->size(); ++j) {
-            if ((*boardGrid)[i][j].getLetter() != ' ' && i < lowerBound) {
-                lowerBound = i;
-            }
-        }
-    }
+    int lowerBound = boardGrid->getTopRow();
 
-    // The board is empty, thus, we reached the end of the boardGrid, and must use the array boundary.
-    if (lowerBound == boardGrid->size() - 1) {
+    // The board is empty, thus, we must use the array boundary.
+    if (lowerBound == -1) {
         lowerBound = 0;
     } else {
         lowerBound = utils::maximum(lowerBound - padding, 0);
@@ -47,17 +32,9 @@ int BoardGridTraverser::getVerticalLowerBound(int padding) {
 }
 
 int BoardGridTraverser::getHorizontalUpperBound(int padding) {
-    int upperBound = -1;
+    int upperBound = boardGrid->getRightColumn();
 
-    for (int i = 0; i < boardGrid->size(); ++i) {
-        for (int j = boardGrid->size() - 1; j >= 0; --j) {
-            if ((*boardGrid)[i][j].getLetter() != ' ' && j > upperBound) {
-                upperBound = j;
-            }
-        }
-    }
-
-    // The board is empty, thus, we reached the end of the boardGrid, and must use the array boundary.
+    // The board is empty, thus, we must use the array boundary.
     if (upperBound == -1) {
         upperBound = boardGrid->size() - 1;
     } else {
@@ -68,18 +45,10 @@ int BoardGridTraverser::getHorizontalUpperBound(int padding) {
 }
 
 int BoardGridTraverser::getHorizontalLowerBound(int padding) {
-    int lowerBound = boardGrid->size() - 1;
-
-    for (int i = 0; i < boardGrid->size(); ++i) {
-        for (int j = 0; j < boardGrid->size(); ++j) {
-            if ((*boardGrid)[i][j].getLetter() != ' ' && j < lowerBound) {
-                lowerBound = j;
-            }
-        }
-    }
+    int lowerBound = boardGrid->getLeftColumn();
 
-    // The board is empty, thus, we reached the end of the boardGrid, and must use the array boundary.
-    if (lowerBound == boardGrid->size() - 1) {
+    // The board is empty, thus, we must use the array boundary.
+    if (lowerBound == -1) {
         lowerBound = 0;
     } else {
         lowerBound = utils::maximum(lowerBound - padding, 0);
@@ -1,7 +1,7 @@
 #ifndef ASSIGNMENT_2_NEW_BOARDGRIDTRAVERSER_H
 #define ASSIGNMENT_2_NEW_BOARDGRIDTRAVERSER_H
 
-#include "../../utility/typedefs.h"
+#include "BoardGrid.h"
 #include "../../utility/utils.h"
 
 class BoardGridTraverser {
@@ -0,0 +1,16 @@
+#ifndef ASSIGNMENT_2_NEW_BOARDSIZES_H
+#define ASSIGNMENT_2_NEW_BOARDSIZES_H
+
+/*
+ * The sizes of board that can be played on (see Board). They live apart from Board, so that the
+ * structures a board is built from (i.e., Bitboard) can be specialised for them without
+ * depending on it.
+ */
+
+// The number of rows (and columns) of a standard board.
+const int STANDARD_BOARD_SIZE = 15;
+
+// The number of rows (and columns) of a Super Scrabble board.
+const int SUPER_BOARD_SIZE = 21;
+
+#endif //ASSIGNMENT_2_NEW_BOARDSIZES_H
@@ -0,0 +1,86 @@
+#include "PremiumSquares.h"
+#include <fstream>
+#include <stdexcept>
+#include "../../utility/utils.h"
+
+PremiumSquares::PremiumSquares(int sizeDim)
+        : dimension(sizeDim), letterMultipliers(sizeDim * sizeDim, 1),
+          wordMultipliers(sizeDim * sizeDim, 1) {
+}
+
+PremiumSquares PremiumSquares::readFromFile(const std::string &path) {
+    utils::fileExistsElseThrow(path);
+
+    std::ifstream LayoutFile(path);
+    std::string line;
+    std::vector<std::string> rows;
+
+    while (std::getline(LayoutFile, line)) {
+        if (!line.empty()) {
+            rows.push_back(line);
+        }
+    }
+
+    LayoutFile.close();
+
+    int sizeDim = static_cast<int>(rows.size());
+    PremiumSquares layout(sizeDim);
+
+    for (int row = 0; row < sizeDim; ++row) {
+        if (static_cast<int>(rows[row].length()) != sizeDim) {
+            throw std::runtime_error("The premium squares in \"" + path + "\" are not square!");
+        }
+
+        for (int col = 0; col < sizeDim; ++col) {
+            int square = row * sizeDim + col;
+
+            switch (rows[row][col]) {
+                case 'd':
+                    layout.letterMultipliers[square] = 2;
+                    break;
+                case 't':
+                    layout.letterMultipliers[square] = 3;
+                    break;
+                case 'q':
+                    layout.letterMultipliers[square] = 4;
+                    break;
+                case 'D':
+                    layout.wordMultipliers[square] = 2;
+                    break;
+                case 'T':
+                    layout.wordMultipliers[square] = 3;
+                    break;
+                case 'Q':
+                    layout.wordMultipliers[square] = 4;
+                    break;
+                case '.':
+                    break;
+                default:
+                    throw std::runtime_error("Unknown premium square '" +
+                                             std::string(1, rows[row][col]) + "' in \"" + path + "\"!");
+            }
+        }
+    }
+
+    return layout;
+}
+
+int PremiumSquares::size() const {
+    return dimension;
+}
+
+int PremiumSquares::getLetterMultiplier(int row, int col) const {
+    return letterMultipliers[row * dimension + col];
+}
+
+int PremiumSquares::getWordMultiplier(int row, int col) const {
+    return wordMultipliers[row * dimension + col];
+}
+
+const std::uint8_t *PremiumSquares::getLetterMultipliers() const {
+    return letterMultipliers.data();
+}
+
+const std::uint8_t *PremiumSquares::getWordMultipliers() const {
+    return wordMultipliers.data();
+}
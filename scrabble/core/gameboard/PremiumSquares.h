@@ -0,0 +1,51 @@
+#ifndef ASSIGNMENT_2_NEW_PREMIUMSQUARES_H
+#define ASSIGNMENT_2_NEW_PREMIUMSQUARES_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*
+ * The premium squares of a (square) board: how many times a tile placed on each square counts
+ * towards its words (its letter multiplier), and how many times the words through it count (its
+ * word multiplier). Both are kept in flat tables laid out like the BoardGrid (row-major), so a
+ * square's multipliers are found with a single index. Squares that are not premium have a
+ * multiplier of 1 for both.
+ *
+ * Premiums only count for the turn a square is first covered, which is up to the scorer (see
+ * Board::scoreMove()).
+ */
+class PremiumSquares {
+public:
+    // Creates a layout of sizeDim x sizeDim squares without any premiums.
+    explicit PremiumSquares(int sizeDim);
+
+    /*
+     * Reads in a layout from a file of one line per row, with one character per square:
+     *   '.' for a plain square,
+     *   'd' for a double letter square, 't' for a triple letter square,
+     *   'D' for a double word square and 'T' for a triple word square,
+     *   'q' for a quadruple letter square and 'Q' for a quadruple word square (as on a Super
+     *   Scrabble board).
+     * The layout must be square.
+     */
+    static PremiumSquares readFromFile(const std::string &path);
+
+    int size() const;
+
+    int getLetterMultiplier(int row, int col) const;
+
+    int getWordMultiplier(int row, int col) const;
+
+    // Return the multipliers of every square, row by row (see BoardGrid::data()).
+    const std::uint8_t *getLetterMultipliers() const;
+
+    const std::uint8_t *getWordMultipliers() const;
+
+private:
+    int dimension;
+    std::vector<std::uint8_t> letterMultipliers;
+    std::vector<std::uint8_t> wordMultipliers;
+};
+
+#endif //ASSIGNMENT_2_NEW_PREMIUMSQUARES_H
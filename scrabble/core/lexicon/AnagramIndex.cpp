@@ -0,0 +1,138 @@
+#include "AnagramIndex.h"
+#include <algorithm>
+#include <utility>
+
+const std::uint32_t AnagramIndex::NO_GROUP;
+
+AnagramIndex::AnagramIndex(const Dawg &dawg) {
+    std::vector<std::string> allWords;
+    dawg.forEachWord([&allWords](const std::string &word) {
+        allWords.push_back(word);
+    });
+
+    // Pair every word with its letters in sorted order, so that sorting brings anagrams together.
+    std::vector<std::pair<std::string, std::string> > keyed;
+    keyed.reserve(allWords.size());
+    for (auto &word: allWords) {
+        std::string key = word;
+        std::sort(key.begin(), key.end());
+        keyed.emplace_back(std::move(key), std::move(word));
+    }
+    std::sort(keyed.begin(), keyed.end());
+
+    for (std::size_t i = 0; i < keyed.size(); ++i) {
+        // A new group begins whenever the sorted letters change.
+        if (i == 0 || keyed[i].first != keyed[i - 1].first) {
+            groupStarts.push_back(wordStarts.size());
+            groupSignatures.push_back(
+                    signatureOf(countLetters(keyed[i].first.data(), keyed[i].first.length())));
+        }
+
+        wordStarts.push_back(words.length());
+        words.append(keyed[i].second);
+    }
+    groupStarts.push_back(wordStarts.size());
+    wordStarts.push_back(words.length());
+
+    // Keep the table at most half full, so that probes stay short (and always find a free slot).
+    std::size_t tableSize = 2;
+    while (tableSize < groupSignatures.size() * 2) {
+        tableSize *= 2;
+    }
+    table.assign(tableSize, NO_GROUP);
+
+    for (std::uint32_t group = 0; group < groupSignatures.size(); ++group) {
+        std::size_t slot = groupSignatures[group] & (tableSize - 1);
+        while (table[slot] != NO_GROUP) {
+            slot = (slot + 1) & (tableSize - 1);
+        }
+        table[slot] = group;
+    }
+}
+
+void AnagramIndex::forEachAnagram(const std::string &letters, const WordVisitor &visit) const {
+    std::uint32_t group = findGroup(countLetters(letters.data(), letters.length()));
+
+    if (group != NO_GROUP) {
+        visitGroup(group, visit);
+    }
+}
+
+void AnagramIndex::forEachWordFrom(const std::string &rack, const WordVisitor &visit) const {
+    LetterCounts rackCounts = countLetters(rack.data(), rack.length());
+    LetterCounts chosen{};
+
+    visitSubRacks(rackCounts, chosen, 0, 0, visit);
+}
+
+AnagramIndex::LetterCounts AnagramIndex::countLetters(const char *letters, std::size_t length) {
+    LetterCounts counts{};
+
+    for (std::size_t i = 0; i < length; ++i) {
+        int code = letterCodeOf(letters[i]);
+        if (code != NO_LETTER) {
+            ++counts[code];
+        }
+    }
+
+    return counts;
+}
+
+std::uint64_t AnagramIndex::signatureOf(const LetterCounts &counts) {
+    // 64-bit FNV-1a over the counts.
+    std::uint64_t hash = 14695981039346656037ull;
+
+    for (unsigned char count: counts) {
+        hash ^= count;
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+std::uint32_t AnagramIndex::findGroup(const LetterCounts &counts) const {
+    std::uint64_t signature = signatureOf(counts);
+    std::uint32_t found = NO_GROUP;
+
+    for (std::size_t slot = signature & (table.size() - 1);
+         table[slot] != NO_GROUP && found == NO_GROUP; slot = (slot + 1) & (table.size() - 1)) {
+        std::uint32_t group = table[slot];
+
+        // Rule out hash collisions by comparing against the group's first word.
+        if (groupSignatures[group] == signature) {
+            std::uint32_t firstWord = groupStarts[group];
+            LetterCounts groupCounts = countLetters(
+                    words.data() + wordStarts[firstWord],
+                    wordStarts[firstWord + 1] - wordStarts[firstWord]);
+
+            if (groupCounts == counts) {
+                found = group;
+            }
+        }
+    }
+
+    return found;
+}
+
+void AnagramIndex::visitGroup(std::uint32_t group, const WordVisitor &visit) const {
+    for (std::uint32_t word = groupStarts[group]; word < groupStarts[group + 1]; ++word) {
+        visit(words.data() + wordStarts[word], wordStarts[word + 1] - wordStarts[word]);
+    }
+}
+
+void AnagramIndex::visitSubRacks(LetterCounts &rack, LetterCounts &chosen, int letter,
+                                 std::size_t size, const WordVisitor &visit) const {
+    if (letter == 26) {
+        std::uint32_t group = size > 0 ? findGroup(chosen) : NO_GROUP;
+
+        if (group != NO_GROUP) {
+            visitGroup(group, visit);
+        }
+    } else {
+        for (int count = 0; count <= rack[letter]; ++count) {
+            chosen[letter] = count;
+            visitSubRacks(rack, chosen, letter + 1, size + count, visit);
+        }
+        chosen[letter] = 0;
+    }
+}
@@ -0,0 +1,71 @@
+#ifndef ASSIGNMENT_2_NEW_ANAGRAMINDEX_H
+#define ASSIGNMENT_2_NEW_ANAGRAMINDEX_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "Dawg.h"
+
+// Called with a word's letters (lowercase, not null terminated) and its length.
+typedef std::function<void(const char *, std::size_t)> WordVisitor;
+
+/*
+ * An index from a multiset of letters (i.e., the contents of a rack, in any order) to every word
+ * that is spelt with exactly those letters. Words sharing a multiset are stored back to back in
+ * one buffer, and each multiset is found through a hash of its 26 letter counts, so answering a
+ * query never has to scan the words list.
+ *
+ * This makes questions like "which words could this hand play?" cheap: a 7 tile rack has at most
+ * 2^7 sub-multisets, and each of them is a single hash lookup.
+ */
+class AnagramIndex {
+public:
+    // Builds the index from every word in the graph.
+    explicit AnagramIndex(const Dawg &dawg);
+
+    // Visits every word that uses exactly the given letters (in any order, and in either case).
+    void forEachAnagram(const std::string &letters, const WordVisitor &visit) const;
+
+    /*
+     * Visits every word that can be spelt with some or all of the rack's letters (in either case),
+     * such as the letters of a player's hand. Each word is visited exactly once.
+     */
+    void forEachWordFrom(const std::string &rack, const WordVisitor &visit) const;
+
+private:
+    typedef std::array<unsigned char, 26> LetterCounts;
+
+    static const std::uint32_t NO_GROUP = 0xFFFFFFFF;
+
+    // Counts how many of each letter a-z/A-Z appear (anything else is ignored).
+    static LetterCounts countLetters(const char *letters, std::size_t length);
+
+    // Hashes a set of letter counts, such that every arrangement of the same letters agrees.
+    static std::uint64_t signatureOf(const LetterCounts &counts);
+
+    // Returns the group of words with exactly these letter counts, or NO_GROUP.
+    std::uint32_t findGroup(const LetterCounts &counts) const;
+
+    void visitGroup(std::uint32_t group, const WordVisitor &visit) const;
+
+    /*
+     * Recursively picks between none and all of the rack's copies of each letter (from the given
+     * letter onwards), visiting the words of every resulting sub-multiset.
+     */
+    void visitSubRacks(LetterCounts &rack, LetterCounts &chosen, int letter, std::size_t size,
+                       const WordVisitor &visit) const;
+
+    // Every word, grouped by letter multiset, back to back.
+    std::string words;
+    // Where each word starts in words, plus one final entry marking the end of the last word.
+    std::vector<std::uint32_t> wordStarts;
+    // The first word of each group, plus one final entry marking the end of the last group.
+    std::vector<std::uint32_t> groupStarts;
+    std::vector<std::uint64_t> groupSignatures;
+    // Open addressing hash table of group indexes (NO_GROUP marks an empty slot).
+    std::vector<std::uint32_t> table;
+};
+
+#endif //ASSIGNMENT_2_NEW_ANAGRAMINDEX_H
@@ -0,0 +1,74 @@
+#include "BloomFilter.h"
+#include <cmath>
+#include "LetterCode.h"
+
+BloomFilter::BloomFilter(std::size_t expectedWords, int bitsPerWord) {
+    bitCount = static_cast<std::uint64_t>(expectedWords) * bitsPerWord;
+    if (bitCount < 64) {
+        bitCount = 64;
+    }
+    bits.assign((bitCount + 63) / 64, 0);
+
+    // bitsPerWord * ln(2) probes minimises the false positive rate for a given size.
+    probes = static_cast<int>(std::lround(bitsPerWord * 0.6931));
+    if (probes < 1) {
+        probes = 1;
+    }
+}
+
+void BloomFilter::hashWord(const LetterView &word, std::uint64_t &first, std::uint64_t &second) {
+    /*
+     * Two different hashes over the letter codes (so that both cases hash the same), each with its
+     * own seed, in a single pass: 64-bit FNV-1a, and a multiply-rotate hash (as in wyhash/FxHash).
+     * Neither is derived from the other, so two words that collide in one are no more likely to
+     * collide in the other.
+     */
+    first = 14695981039346656037ull;
+    second = 0x243F6A8885A308D3ull;
+    for (std::size_t i = 0; i < word.length; ++i) {
+        auto code = static_cast<unsigned char>(letterCodeOf(word[i]));
+
+        first ^= code;
+        first *= 1099511628211ull;
+
+        second = ((second << 5) | (second >> 59)) ^ code;
+        second *= 0x9E3779B97F4A7C15ull;
+    }
+
+    // Finish the second hash (splitmix64's finaliser), so that its low bits depend on every letter.
+    second = (second ^ (second >> 30)) * 0xBF58476D1CE4E5B9ull;
+    second = (second ^ (second >> 27)) * 0x94D049BB133111EBull;
+    // An odd step never cycles back to the first probe early.
+    second = (second ^ (second >> 31)) | 1u;
+}
+
+void BloomFilter::add(const LetterView &word) {
+    std::uint64_t first;
+    std::uint64_t second;
+    hashWord(word, first, second);
+
+    // Double hashing: probe i lands on first + i * second.
+    for (int i = 0; i < probes; ++i) {
+        std::uint64_t bit = (first + i * second) % bitCount;
+        bits[bit / 64] |= std::uint64_t(1) << (bit % 64);
+    }
+}
+
+bool BloomFilter::mightContain(const LetterView &word) const {
+    std::uint64_t first;
+    std::uint64_t second;
+    hashWord(word, first, second);
+
+    bool allSet = true;
+
+    for (int i = 0; i < probes && allSet; ++i) {
+        std::uint64_t bit = (first + i * second) % bitCount;
+        allSet = ((bits[bit / 64] >> (bit % 64)) & 1u) != 0;
+    }
+
+    return allSet;
+}
+
+std::size_t BloomFilter::sizeInBytes() const {
+    return bits.size() * sizeof(std::uint64_t);
+}
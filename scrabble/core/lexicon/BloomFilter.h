@@ -0,0 +1,43 @@
+#ifndef ASSIGNMENT_2_NEW_BLOOMFILTER_H
+#define ASSIGNMENT_2_NEW_BLOOMFILTER_H
+
+#include <cstdint>
+#include <vector>
+#include "LetterView.h"
+
+/*
+ * A Bloom filter over words: a compact bit array that can say for certain that a word is NOT in a
+ * set after a few hash probes, and otherwise says it "might" be (with a tunable false positive
+ * rate). Put in front of an exact lookup, it rejects most non-words without touching the exact
+ * structure at all, which pays off when most candidate words are invalid (i.e., AI searches).
+ *
+ * The trade-off between memory and false positives is set by the number of bits per word:
+ * roughly, 5 bits gives ~10% false positives, 10 bits ~1%, and 15 bits ~0.1%.
+ */
+class BloomFilter {
+public:
+    /*
+     * Creates an empty filter sized for the given number of words. The number of probes per
+     * lookup is derived from bitsPerWord, which must be at least 1.
+     */
+    BloomFilter(std::size_t expectedWords, int bitsPerWord);
+
+    // Adds a word (in either case) to the filter.
+    void add(const LetterView &word);
+
+    // Returns false if the word (in either case) is definitely not in the set, and true if it might be.
+    bool mightContain(const LetterView &word) const;
+
+    // Returns how much memory the bit array takes up, in bytes.
+    std::size_t sizeInBytes() const;
+
+private:
+    // Produces the two independent hashes that every probe position is derived from.
+    static void hashWord(const LetterView &word, std::uint64_t &first, std::uint64_t &second);
+
+    std::vector<std::uint64_t> bits;
+    std::uint64_t bitCount;
+    int probes;
+};
+
+#endif //ASSIGNMENT_2_NEW_BLOOMFILTER_H
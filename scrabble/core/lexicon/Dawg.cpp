@@ -0,0 +1,199 @@
+#include "Dawg.h"
+#include <stdexcept>
+
+// Pre-C++17, static constants that are bound to references still need a definition.
+const std::uint32_t Dawg::NONE;
+const DawgEdge Dawg::LETTER_MASK;
+const DawgEdge Dawg::WORD_END_FLAG;
+const DawgEdge Dawg::LAST_EDGE_FLAG;
+const int Dawg::CHILD_SHIFT;
+const std::uint32_t Dawg::MAX_EDGES;
+const std::size_t Dawg::MAX_BATCH_SIZE;
+const std::size_t Dawg::MAX_WORD_LENGTH;
+
+// Returns the length of the prefix that two words share (ignoring case).
+static std::size_t commonPrefixLength(const LetterView &a, const LetterView &b) {
+    std::size_t length = 0;
+
+    while (length < a.length && length < b.length &&
+           letterCodeOf(a[length]) == letterCodeOf(b[length])) {
+        ++length;
+    }
+
+    return length;
+}
+
+// Returns whether word a sorts strictly before word b (ignoring case).
+static bool isBefore(const LetterView &a, const LetterView &b) {
+    std::size_t common = commonPrefixLength(a, b);
+
+    return common < b.length &&
+           (common == a.length || letterCodeOf(a[common]) < letterCodeOf(b[common]));
+}
+
+Dawg::Dawg(std::vector<DawgEdge> edges) : ownedEdges(std::move(edges)), mapping(nullptr) {
+    this->edges = ownedEdges.data();
+    this->numEdges = ownedEdges.size();
+}
+
+Dawg::Dawg(MappedFile *mapping, const DawgEdge *edges, std::size_t edgeCount)
+        : edges(edges), numEdges(edgeCount), mapping(mapping) {}
+
+Dawg::~Dawg() {
+    delete mapping;
+}
+
+bool Dawg::contains(const std::string &word) const {
+    std::uint32_t node = root();
+    std::uint32_t edge = NONE;
+    bool pathExists = !word.empty();
+
+    // Follow one edge per letter (findEdge() copes with running out of graph via NONE).
+    for (std::size_t i = 0; i < word.length() && pathExists; ++i) {
+        edge = findEdge(node, letterCodeOf(word[i]));
+        pathExists = edge != NONE;
+
+        if (pathExists) {
+            node = getChild(edge);
+        }
+    }
+
+    return pathExists && isWordEnd(edge);
+}
+
+std::uint64_t Dawg::findMissingWords(const LetterView *words, std::size_t count) const {
+    if (count > MAX_BATCH_SIZE) {
+        throw std::invalid_argument("Too many words to check in a single batch!");
+    }
+
+    // Insertion sort the batch (by index), as it is always tiny.
+    unsigned char order[MAX_BATCH_SIZE];
+    for (std::size_t i = 0; i < count; ++i) {
+        std::size_t j = i;
+        while (j > 0 && isBefore(words[i], words[order[j - 1]])) {
+            order[j] = order[j - 1];
+            --j;
+        }
+        order[j] = static_cast<unsigned char>(i);
+    }
+
+    /*
+     * nodes[d] is the node reached after following the first d letters of the previous word, and
+     * edges[d] is the edge that reached it. Only the first reached of them are valid.
+     */
+    std::uint32_t nodes[MAX_WORD_LENGTH + 1];
+    std::uint32_t edges[MAX_WORD_LENGTH + 1];
+    std::size_t reached = 0;
+    nodes[0] = root();
+
+    std::uint64_t missing = 0;
+    const LetterView *previous = nullptr;
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const LetterView &word = words[order[i]];
+
+        // Resume from the deepest point of the previous word's walk that this word shares.
+        std::size_t depth = previous == nullptr ? 0 : commonPrefixLength(*previous, word);
+        if (depth > reached) {
+            depth = reached;
+        }
+
+        bool pathExists = word.length > 0 && word.length <= MAX_WORD_LENGTH;
+
+        while (pathExists && depth < word.length) {
+            std::uint32_t edge = findEdge(nodes[depth], letterCodeOf(word[depth]));
+            pathExists = edge != NONE;
+
+            if (pathExists) {
+                edges[depth + 1] = edge;
+                nodes[depth + 1] = getChild(edge);
+                ++depth;
+            }
+        }
+        reached = depth;
+
+        if (!pathExists || !isWordEnd(edges[word.length])) {
+            missing |= std::uint64_t(1) << order[i];
+        }
+
+        previous = &word;
+    }
+
+    return missing;
+}
+
+void Dawg::forEachWord(const std::function<void(const std::string &)> &visit) const {
+    std::string prefix;
+    forEachWordFrom(root(), prefix, visit);
+}
+
+void Dawg::forEachWordFrom(std::uint32_t node, std::string &prefix,
+                           const std::function<void(const std::string &)> &visit) const {
+    bool moreEdges = node != NONE;
+
+    for (std::uint32_t edge = node; moreEdges; ++edge) {
+        prefix.push_back(getLetter(edge));
+
+        if (isWordEnd(edge)) {
+            visit(prefix);
+        }
+        forEachWordFrom(getChild(edge), prefix, visit);
+
+        prefix.pop_back();
+        moreEdges = !isLastEdge(edge);
+    }
+}
+
+std::uint32_t Dawg::root() const {
+    // The root's edge list always directly follows the sentinel.
+    return numEdges > 1 ? 1 : NONE;
+}
+
+std::uint32_t Dawg::findEdge(std::uint32_t node, int letterCode) const {
+    if (node == NONE || letterCode == NO_LETTER) {
+        return NONE;
+    }
+
+    DawgEdge target = static_cast<DawgEdge>(letterCode);
+
+    // Edge lists are sorted by letter, so we can stop as soon as we overshoot.
+    for (std::uint32_t i = node;; ++i) {
+        DawgEdge edgeLetter = edges[i] & LETTER_MASK;
+
+        if (edgeLetter == target) {
+            return i;
+        }
+
+        if (edgeLetter > target || (edges[i] & LAST_EDGE_FLAG) != 0) {
+            return NONE;
+        }
+    }
+}
+
+std::uint32_t Dawg::getChild(std::uint32_t edge) const {
+    return edges[edge] >> CHILD_SHIFT;
+}
+
+bool Dawg::isWordEnd(std::uint32_t edge) const {
+    return (edges[edge] & WORD_END_FLAG) != 0;
+}
+
+char Dawg::getLetter(std::uint32_t edge) const {
+    return static_cast<char>('a' + (edges[edge] & LETTER_MASK));
+}
+
+int Dawg::getLetterCode(std::uint32_t edge) const {
+    return static_cast<int>(edges[edge] & LETTER_MASK);
+}
+
+bool Dawg::isLastEdge(std::uint32_t edge) const {
+    return (edges[edge] & LAST_EDGE_FLAG) != 0;
+}
+
+std::size_t Dawg::edgeCount() const {
+    return numEdges;
+}
+
+const DawgEdge *Dawg::data() const {
+    return edges;
+}
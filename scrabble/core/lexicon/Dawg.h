@@ -0,0 +1,135 @@
+#ifndef ASSIGNMENT_2_NEW_DAWG_H
+#define ASSIGNMENT_2_NEW_DAWG_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "LetterCode.h"
+#include "LetterView.h"
+#include "../../utility/MappedFile.h"
+
+// A single packed DAWG edge (see the Dawg class description for the layout).
+typedef std::uint32_t DawgEdge;
+
+/*
+ * A directed acyclic word graph (DAWG), which is a trie whose identical suffixes have been merged
+ * together. Roughly a quarter of a million words fit into about a megabyte this way, rather than
+ * the many megabytes (and hundreds of thousands of allocations) that a vector of strings costs.
+ *
+ * The whole graph is stored as one flat array of 32-bit edges. The outgoing edges of a node are
+ * stored contiguously (sorted by letter), and a node is referred to by the index of its first
+ * edge. Each edge is packed as follows:
+ *
+ *  bits 0-4   - the letter of the edge, as an index from 0 ('a') to 25 ('z').
+ *  bit 5      - set if a word ends once this edge has been followed.
+ *  bit 6      - set if this is the last edge of its node's edge list.
+ *  bits 7-31  - the node that this edge leads to (0 if it leads to a node without any edges).
+ *
+ * Index 0 of the array is an unused sentinel, which lets 0 double as "no node" and "no edge".
+ *
+ * Words can be looked up in one go with contains(), or letter by letter by starting at root() and
+ * repeatedly calling findEdge() and getChild(). Lookups accept letters in either case, since they
+ * compare letter codes (see LetterCode.h) rather than characters.
+ *
+ * The edge array is either owned by the graph, or lives inside a memory mapped dictionary image
+ * (see DictionaryImage), in which case lookups run straight off the mapped pages.
+ */
+class Dawg {
+public:
+    // Node/edge index meaning "does not exist".
+    static const std::uint32_t NONE = 0;
+
+    static const DawgEdge LETTER_MASK = 0x1F;
+    static const DawgEdge WORD_END_FLAG = 1u << 5;
+    static const DawgEdge LAST_EDGE_FLAG = 1u << 6;
+    static const int CHILD_SHIFT = 7;
+    // The largest number of edges whose indexes still fit into the child field.
+    static const std::uint32_t MAX_EDGES = 1u << (32 - CHILD_SHIFT);
+
+    // Takes ownership of an edge array laid out as described above (usually made by DawgBuilder).
+    explicit Dawg(std::vector<DawgEdge> edges);
+
+    /*
+     * Uses an edge array that lives inside a mapped file, taking ownership of the mapping so that
+     * it stays alive for as long as the graph does. The edges must already have been validated.
+     */
+    Dawg(MappedFile *mapping, const DawgEdge *edges, std::size_t edgeCount);
+
+    ~Dawg();
+
+    // Copying would either duplicate or double-unmap the edges, neither of which is wanted.
+    Dawg(const Dawg &other) = delete;
+
+    Dawg &operator=(const Dawg &other) = delete;
+
+    // The most words that findMissingWords() can check at once (one per bit of its result).
+    static const std::size_t MAX_BATCH_SIZE = 64;
+    // Longer words are never in the graph as far as findMissingWords() is concerned.
+    static const std::size_t MAX_WORD_LENGTH = 32;
+
+    // Returns whether the word (in either case) is in the graph.
+    bool contains(const std::string &word) const;
+
+    /*
+     * Checks a whole batch of words (in either case) in a single walk of the graph, such as all of the
+     * words formed by one move. The batch is visited in sorted order, so that words sharing a
+     * prefix only walk that prefix once, and nothing is allocated along the way.
+     *
+     * Returns a bitmask in which bit i is set if words[i] is NOT in the graph.
+     *
+     * Throws an invalid argument error if more than MAX_BATCH_SIZE words are given.
+     */
+    std::uint64_t findMissingWords(const LetterView *words, std::size_t count) const;
+
+    // Calls visit with every (lowercase) word in the graph, in alphabetical order.
+    void forEachWord(const std::function<void(const std::string &)> &visit) const;
+
+    // Returns the root node, or NONE if the graph holds no words at all.
+    std::uint32_t root() const;
+
+    /*
+     * Finds the edge labelled with the given letter code (see LetterCode.h) that leaves the given
+     * node.
+     *
+     * Returns the index of that edge, or NONE if there is no such edge (or the code is NO_LETTER).
+     */
+    std::uint32_t findEdge(std::uint32_t node, int letterCode) const;
+
+    // Returns the node an edge leads to (NONE if that node has no outgoing edges).
+    std::uint32_t getChild(std::uint32_t edge) const;
+
+    // Returns whether a word ends once the given edge has been followed.
+    bool isWordEnd(std::uint32_t edge) const;
+
+    // Returns the (lowercase) letter an edge is labelled with.
+    char getLetter(std::uint32_t edge) const;
+
+    // Returns the code (0-25) of the letter an edge is labelled with.
+    int getLetterCode(std::uint32_t edge) const;
+
+    /*
+     * Returns whether this is the last edge leaving its node. The edges of a node can be walked
+     * by starting at the node's index and stepping forward until this returns true.
+     */
+    bool isLastEdge(std::uint32_t edge) const;
+
+    // Returns the total number of edges (including the sentinel).
+    std::size_t edgeCount() const;
+
+    // Returns the raw edge array (edgeCount() long), for writing out a dictionary image.
+    const DawgEdge *data() const;
+
+private:
+    // Visits every word reachable from node, each prefixed with prefix.
+    void forEachWordFrom(std::uint32_t node, std::string &prefix,
+                         const std::function<void(const std::string &)> &visit) const;
+
+    // Points into either ownedEdges or mapping.
+    const DawgEdge *edges;
+    std::size_t numEdges;
+    std::vector<DawgEdge> ownedEdges;
+    MappedFile *mapping;
+};
+
+#endif //ASSIGNMENT_2_NEW_DAWG_H
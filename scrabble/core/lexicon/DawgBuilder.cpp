@@ -0,0 +1,172 @@
+#include "DawgBuilder.h"
+#include <fstream>
+#include <queue>
+#include <stdexcept>
+#include "../../utility/utils.h"
+
+DawgBuilder::DawgBuilder() {
+    // Node 0 is always the root.
+    newNode();
+}
+
+std::uint32_t DawgBuilder::newNode() {
+    std::uint32_t index;
+
+    if (freeNodes.empty()) {
+        index = nodes.size();
+        nodes.push_back(BuildNode());
+    } else {
+        index = freeNodes.back();
+        freeNodes.pop_back();
+    }
+
+    nodes[index].terminal = false;
+    nodes[index].edges.clear();
+
+    return index;
+}
+
+void DawgBuilder::add(const std::string &word) {
+    bool placeable = !word.empty();
+
+    for (char c: word) {
+        if (c < 'a' || c > 'z') {
+            placeable = false;
+        }
+    }
+
+    if (placeable && word != previousWord) {
+        if (word < previousWord) {
+            throw std::runtime_error(
+                    "The words list must be sorted, but \"" + word + "\" comes after \"" +
+                    previousWord + "\"!");
+        }
+
+        // Everything past the prefix shared with the previous word can no longer change.
+        std::size_t commonPrefix = 0;
+        while (commonPrefix < word.length() && commonPrefix < previousWord.length() &&
+               word[commonPrefix] == previousWord[commonPrefix]) {
+            ++commonPrefix;
+        }
+        minimise(commonPrefix);
+
+        // Hang the remaining suffix off the end of the shared prefix.
+        std::uint32_t node = unchecked.empty() ? 0 : unchecked.back().child;
+        for (std::size_t i = commonPrefix; i < word.length(); ++i) {
+            std::uint32_t child = newNode();
+            nodes[node].edges.emplace_back(word[i] - 'a', child);
+            unchecked.push_back({node, child});
+            node = child;
+        }
+
+        nodes[node].terminal = true;
+        previousWord = word;
+    }
+}
+
+void DawgBuilder::minimise(std::size_t downTo) {
+    while (unchecked.size() > downTo) {
+        UncheckedEdge edge = unchecked.back();
+        unchecked.pop_back();
+
+        std::string signature = signatureOf(edge.child);
+        auto existing = nodeRegister.find(signature);
+
+        if (existing == nodeRegister.end()) {
+            nodeRegister.emplace(signature, edge.child);
+        } else {
+            // The child is always the parent's newest edge, since words arrive in order.
+            nodes[edge.parent].edges.back().second = existing->second;
+            freeNodes.push_back(edge.child);
+        }
+    }
+}
+
+std::string DawgBuilder::signatureOf(std::uint32_t node) {
+    std::string signature(1, nodes[node].terminal ? 'T' : 'F');
+
+    for (auto &edge: nodes[node].edges) {
+        signature += static_cast<char>(edge.first);
+        signature.append(reinterpret_cast<const char *>(&edge.second), sizeof(edge.second));
+    }
+
+    return signature;
+}
+
+Dawg *DawgBuilder::build() {
+    minimise(0);
+
+    /*
+     * Lay the nodes out breadth-first, so that the first few letters of every lookup (which are
+     * shared by the most words) sit close together in memory.
+     */
+    std::vector<std::uint32_t> offsets(nodes.size(), Dawg::NONE);
+    std::vector<bool> visited(nodes.size(), false);
+    std::vector<std::uint32_t> order;
+    std::queue<std::uint32_t> toVisit;
+    std::size_t nextOffset = 1;
+
+    toVisit.push(0);
+    visited[0] = true;
+
+    while (!toVisit.empty()) {
+        std::uint32_t node = toVisit.front();
+        toVisit.pop();
+
+        if (!nodes[node].edges.empty()) {
+            offsets[node] = nextOffset;
+            nextOffset += nodes[node].edges.size();
+            order.push_back(node);
+        }
+
+        for (auto &edge: nodes[node].edges) {
+            if (!visited[edge.second]) {
+                visited[edge.second] = true;
+                toVisit.push(edge.second);
+            }
+        }
+    }
+
+    if (nextOffset > Dawg::MAX_EDGES) {
+        throw std::runtime_error("The words list is too large to fit into a DAWG!");
+    }
+
+    std::vector<DawgEdge> edges(nextOffset, 0);
+
+    for (std::uint32_t node: order) {
+        auto &nodeEdges = nodes[node].edges;
+
+        for (std::size_t i = 0; i < nodeEdges.size(); ++i) {
+            std::uint32_t child = nodeEdges[i].second;
+            DawgEdge packed = nodeEdges[i].first | (offsets[child] << Dawg::CHILD_SHIFT);
+
+            if (nodes[child].terminal) {
+                packed |= Dawg::WORD_END_FLAG;
+            }
+            if (i == nodeEdges.size() - 1) {
+                packed |= Dawg::LAST_EDGE_FLAG;
+            }
+
+            edges[offsets[node] + i] = packed;
+        }
+    }
+
+    return new Dawg(std::move(edges));
+}
+
+Dawg *DawgBuilder::buildFromWordsFile(const std::string &path) {
+    utils::fileExistsElseThrow(path);
+    // Load file.
+    std::ifstream WordsList(path);
+    std::string line;
+
+    // Stream the words straight into the graph, rather than holding every line in memory.
+    DawgBuilder builder;
+
+    while (std::getline(WordsList, line)) {
+        builder.add(line);
+    }
+    WordsList.close();
+
+    return builder.build();
+}
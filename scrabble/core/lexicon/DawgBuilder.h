@@ -0,0 +1,73 @@
+#ifndef ASSIGNMENT_2_NEW_DAWGBUILDER_H
+#define ASSIGNMENT_2_NEW_DAWGBUILDER_H
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <unordered_map>
+#include "Dawg.h"
+
+/*
+ * Builds a minimal Dawg from a sorted stream of words, using Daciuk et al.'s incremental
+ * algorithm. Only the path of the most recently added word is ever left unminimised, so the
+ * full trie never has to exist in memory at once.
+ *
+ * Usage: call add() for every word in ascending order, then call build() once.
+ */
+class DawgBuilder {
+public:
+    DawgBuilder();
+
+    /*
+     * Adds a word to the graph. Words must be added in ascending (byte-wise) order; repeats of the
+     * previous word are ignored. Words containing anything other than the lowercase letters a-z
+     * can never be formed from tiles, so they are skipped.
+     *
+     * Throws a runtime error if the word is out of order.
+     */
+    void add(const std::string &word);
+
+    // Minimises what remains, then packs the graph into its flat edge array form.
+    Dawg *build();
+
+    /*
+     * Reads a plain text words list (one sorted word per line, such as official_words_list.txt)
+     * and builds its graph.
+     *
+     * Throws a runtime error if the file does not exist or is not sorted.
+     */
+    static Dawg *buildFromWordsFile(const std::string &path);
+
+private:
+    // A trie node as it exists during construction. Edges are (letter index, node index) pairs.
+    struct BuildNode {
+        bool terminal;
+        std::vector<std::pair<unsigned char, std::uint32_t> > edges;
+    };
+
+    // An edge on the path of the previous word that has not yet been minimised.
+    struct UncheckedEdge {
+        std::uint32_t parent;
+        std::uint32_t child;
+    };
+
+    // Allocates a fresh (or recycled) node, and returns its index.
+    std::uint32_t newNode();
+
+    /*
+     * Minimises the unchecked path until only downTo edges of it remain, by replacing each child
+     * with an equivalent node from the register if one exists.
+     */
+    void minimise(std::size_t downTo);
+
+    // Produces a key that is equal for two nodes exactly when their sub-graphs are equivalent.
+    std::string signatureOf(std::uint32_t node);
+
+    std::vector<BuildNode> nodes;
+    std::vector<std::uint32_t> freeNodes;
+    std::vector<UncheckedEdge> unchecked;
+    std::unordered_map<std::string, std::uint32_t> nodeRegister;
+    std::string previousWord;
+};
+
+#endif //ASSIGNMENT_2_NEW_DAWGBUILDER_H
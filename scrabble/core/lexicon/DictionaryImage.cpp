@@ -0,0 +1,150 @@
+#include "DictionaryImage.h"
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <stdexcept>
+#include <sys/stat.h>
+
+const std::uint32_t DictionaryImage::VERSION;
+
+// Never matches a words list's modification time, so that the words list is always hashed.
+static const std::int64_t UNKNOWN_SOURCE_TIME = -1;
+
+static const char IMAGE_MAGIC[8] = {'S', 'C', 'R', 'B', 'D', 'A', 'W', 'G'};
+
+void DictionaryImage::write(const Dawg &dawg, const std::string &path,
+                            const std::string &wordsListPath) {
+    Header header{};
+    std::memcpy(header.magic, IMAGE_MAGIC, sizeof(IMAGE_MAGIC));
+    header.version = VERSION;
+    header.edgeCount = static_cast<std::uint32_t>(dawg.edgeCount());
+    header.checksum = checksumOf(dawg.data(), dawg.edgeCount());
+    header.source = checksumOfFile(wordsListPath);
+    statFile(wordsListPath, header.sourceSize, header.sourceTime);
+
+    /*
+     * Times are only to the second, so a words list modified within the second the image is
+     * compiled could be edited again without its time changing. Such an image is always hashed.
+     */
+    if (header.sourceTime >= static_cast<std::int64_t>(std::time(nullptr))) {
+        header.sourceTime = UNKNOWN_SOURCE_TIME;
+    }
+
+    std::ofstream ImageFile(path, std::ios::binary | std::ios::trunc);
+    ImageFile.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    ImageFile.write(reinterpret_cast<const char *>(dawg.data()),
+                    static_cast<std::streamsize>(dawg.edgeCount() * sizeof(DawgEdge)));
+    ImageFile.close();
+
+    if (!ImageFile) {
+        throw std::runtime_error("The dictionary image \"" + path + "\" could not be written!");
+    }
+}
+
+Dawg *DictionaryImage::map(const std::string &path, const std::string &wordsListPath) {
+    auto *mapping = new MappedFile(path);
+    const auto *bytes = static_cast<const char *>(mapping->data());
+
+    Header header{};
+    bool valid = mapping->size() >= sizeof(header);
+
+    if (valid) {
+        std::memcpy(&header, bytes, sizeof(header));
+        valid = std::memcmp(header.magic, IMAGE_MAGIC, sizeof(IMAGE_MAGIC)) == 0 &&
+                header.version == VERSION &&
+                mapping->size() == sizeof(header) + header.edgeCount * sizeof(DawgEdge);
+    }
+
+    // The header is a multiple of the edge size, so the (page aligned) edges are aligned too.
+    const auto *edges = reinterpret_cast<const DawgEdge *>(bytes + sizeof(header));
+
+    if (valid) {
+        valid = checksumOf(edges, header.edgeCount) == header.checksum &&
+                isStructureValid(edges, header.edgeCount);
+    }
+
+    /*
+     * Without the words list there is nothing to be stale against, so the image is all there is.
+     * Otherwise it is only hashed if it has changed size or been modified since the image was
+     * compiled (i.e., it was edited without the image being rebuilt, or merely copied).
+     */
+    std::uint64_t sourceSize;
+    std::int64_t sourceTime;
+    if (valid && statFile(wordsListPath, sourceSize, sourceTime) &&
+        (sourceSize != header.sourceSize || sourceTime != header.sourceTime)) {
+        valid = checksumOfFile(wordsListPath) == header.source;
+    }
+
+    if (!valid) {
+        delete mapping;
+        throw std::runtime_error("The dictionary image \"" + path + "\" is invalid, corrupt or out of date!");
+    }
+
+    return new Dawg(mapping, edges, header.edgeCount);
+}
+
+std::string DictionaryImage::imagePathFor(const std::string &wordsListPath) {
+    std::size_t extension = wordsListPath.rfind('.');
+    std::size_t directory = wordsListPath.rfind('/');
+
+    // Only strip an extension if it belongs to the file name rather than a directory (i.e., "../").
+    if (extension != std::string::npos &&
+        (directory == std::string::npos || extension > directory)) {
+        return wordsListPath.substr(0, extension) + ".dawg";
+    }
+
+    return wordsListPath + ".dawg";
+}
+
+std::uint32_t DictionaryImage::checksumOf(const DawgEdge *edges, std::size_t edgeCount) {
+    std::uint32_t hash = 2166136261u;
+
+    for (std::size_t i = 0; i < edgeCount; ++i) {
+        hash ^= edges[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+std::uint32_t DictionaryImage::checksumOfFile(const std::string &path) {
+    std::ifstream SourceFile(path, std::ios::binary);
+    std::uint32_t hash = 2166136261u;
+    char buffer[1 << 16];
+
+    if (!SourceFile) {
+        throw std::runtime_error("The filename \"" + path + "\" could not be read!");
+    }
+
+    while (SourceFile.read(buffer, sizeof(buffer)) || SourceFile.gcount() > 0) {
+        for (std::streamsize i = 0; i < SourceFile.gcount(); ++i) {
+            hash ^= static_cast<unsigned char>(buffer[i]);
+            hash *= 16777619u;
+        }
+    }
+
+    return hash;
+}
+
+bool DictionaryImage::statFile(const std::string &path, std::uint64_t &size, std::int64_t &time) {
+    struct stat fileInfo{};
+    bool found = stat(path.c_str(), &fileInfo) == 0;
+
+    if (found) {
+        size = static_cast<std::uint64_t>(fileInfo.st_size);
+        time = static_cast<std::int64_t>(fileInfo.st_mtime);
+    }
+
+    return found;
+}
+
+bool DictionaryImage::isStructureValid(const DawgEdge *edges, std::size_t edgeCount) {
+    bool valid = edgeCount == 0 || (edges[edgeCount - 1] & Dawg::LAST_EDGE_FLAG) != 0;
+
+    for (std::size_t i = 1; i < edgeCount && valid; ++i) {
+        valid = (edges[i] & Dawg::LETTER_MASK) < 26 &&
+                (edges[i] >> Dawg::CHILD_SHIFT) < edgeCount;
+    }
+
+    return valid;
+}
@@ -0,0 +1,87 @@
+#ifndef ASSIGNMENT_2_NEW_DICTIONARYIMAGE_H
+#define ASSIGNMENT_2_NEW_DICTIONARYIMAGE_H
+
+#include <cstdint>
+#include <string>
+#include "Dawg.h"
+
+/*
+ * A precompiled, binary form of a Dawg that can be memory mapped and used as-is, so that the game
+ * never has to parse the plain text words list at startup. Images are produced offline by the
+ * DictionaryCompiler tool.
+ *
+ * The layout is a fixed header followed directly by the Dawg's edge array, both in the native
+ * byte order of the machine that compiled them:
+ *
+ *  magic      - 8 bytes, always "SCRBDAWG".
+ *  version    - 32-bit format version (an image from a machine of the other endianness will not
+ *               match, and is rejected along with images from other versions).
+ *  edgeCount  - 32-bit number of edges that follow the header.
+ *  checksum   - 32-bit FNV-1a hash of the edges.
+ *  source     - 32-bit FNV-1a hash of the words list the image was compiled from, so that an
+ *               image left behind after the words list is edited is never served in its place.
+ *  sourceSize - 64-bit size of that words list, in bytes.
+ *  sourceTime - 64-bit time that words list was last modified, in seconds. The words list is only
+ *               hashed if its size or modification time no longer match, so that the usual load
+ *               never has to read it.
+ */
+class DictionaryImage {
+public:
+    // Bump whenever the header or the edge layout changes.
+    static const std::uint32_t VERSION = 3;
+
+    /*
+     * Writes a graph, compiled from the given words list, out as an image.
+     *
+     * Throws a runtime error if the words list cannot be read or the file cannot be written.
+     */
+    static void write(const Dawg &dawg, const std::string &path, const std::string &wordsListPath);
+
+    /*
+     * Maps an image read-only, and validates its header, checksum and structure before handing
+     * back a Dawg that runs straight off the mapping. If the words list it was compiled from still
+     * exists and has been modified since, the image must also have been compiled from its current
+     * contents.
+     *
+     * Throws a runtime error if the file is missing, truncated, corrupt, stale or from another
+     * version.
+     */
+    static Dawg *map(const std::string &path, const std::string &wordsListPath);
+
+    /*
+     * Given the path of a plain text words list, returns the path its compiled image is expected
+     * at (i.e., official_words_list.txt -> official_words_list.dawg).
+     */
+    static std::string imagePathFor(const std::string &wordsListPath);
+
+private:
+    struct Header {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t edgeCount;
+        std::uint32_t checksum;
+        std::uint32_t source;
+        std::uint64_t sourceSize;
+        std::int64_t sourceTime;
+    };
+
+    // FNV-1a over the edges, taken a whole edge at a time.
+    static std::uint32_t checksumOf(const DawgEdge *edges, std::size_t edgeCount);
+
+    // FNV-1a over every byte of a file. Throws a runtime error if the file cannot be read.
+    static std::uint32_t checksumOfFile(const std::string &path);
+
+    /*
+     * Finds the size and last modification time (in seconds) of a file. Returns false if the file
+     * cannot be found.
+     */
+    static bool statFile(const std::string &path, std::uint64_t &size, std::int64_t &time);
+
+    /*
+     * Checks that every edge points inside the array and that the final edge list is terminated,
+     * so that a damaged image can never send a lookup outside the mapping.
+     */
+    static bool isStructureValid(const DawgEdge *edges, std::size_t edgeCount);
+};
+
+#endif //ASSIGNMENT_2_NEW_DICTIONARYIMAGE_H
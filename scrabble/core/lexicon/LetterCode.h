@@ -0,0 +1,21 @@
+#ifndef ASSIGNMENT_2_NEW_LETTERCODE_H
+#define ASSIGNMENT_2_NEW_LETTERCODE_H
+
+/*
+ * The canonical encoding of letters used throughout the lexicon, which is the same encoding that
+ * DAWG edges are labelled with: 0 for 'a' through to 25 for 'z'. Both cases map to the same code,
+ * so the uppercase letters on the board can be looked up as they are, without first converting
+ * (and copying) them.
+ */
+
+// The code of anything that is not a letter.
+const int NO_LETTER = -1;
+
+// Returns the code (0-25) of a letter in either case, or NO_LETTER if it is not a letter.
+inline int letterCodeOf(char c) {
+    // Setting bit 5 lowercases a letter, and leaves everything that was not one outside a-z.
+    unsigned int code = static_cast<unsigned char>(c | 0x20) - static_cast<unsigned int>('a');
+    return code < 26 ? static_cast<int>(code) : NO_LETTER;
+}
+
+#endif //ASSIGNMENT_2_NEW_LETTERCODE_H
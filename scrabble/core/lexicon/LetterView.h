@@ -0,0 +1,23 @@
+#ifndef ASSIGNMENT_2_NEW_LETTERVIEW_H
+#define ASSIGNMENT_2_NEW_LETTERVIEW_H
+
+#include <cstddef>
+
+/*
+ * A read-only view of a word's letters inside some larger buffer, without copying them. The
+ * letters do not have to be contiguous: consecutive letters are stride bytes apart, so the same
+ * view type can walk along a row of a grid (stride 1) or down one of its columns (stride = row
+ * width).
+ */
+struct LetterView {
+    const char *start;
+    std::size_t length;
+    std::ptrdiff_t stride;
+
+    // Returns the letter at the given position of the word.
+    char operator[](std::size_t pos) const {
+        return start[static_cast<std::ptrdiff_t>(pos) * stride];
+    }
+};
+
+#endif //ASSIGNMENT_2_NEW_LETTERVIEW_H
@@ -0,0 +1,140 @@
+#include "Lexicon.h"
+
+/*
+ * Fills in the word lengths of every edge leaving node (see Lexicon::getWordLengths()), and
+ * returns all of them combined. Shared nodes are only ever worked out once.
+ */
+static std::uint32_t fillWordLengths(const Dawg &dawg, std::uint32_t node,
+                                     std::vector<std::uint32_t> &lengths,
+                                     std::vector<bool> &filled) {
+    std::uint32_t combined = 0;
+    bool moreEdges = node != Dawg::NONE;
+
+    for (std::uint32_t edge = node; moreEdges; ++edge) {
+        if (!filled[edge]) {
+            std::uint32_t below = fillWordLengths(dawg, dawg.getChild(edge), lengths, filled);
+            lengths[edge] = (below << 1) | (dawg.isWordEnd(edge) ? 1u : 0u);
+            filled[edge] = true;
+        }
+
+        combined |= lengths[edge];
+        moreEdges = !dawg.isLastEdge(edge);
+    }
+
+    return combined;
+}
+
+Lexicon::Lexicon(Dawg *dawg, int bloomFilterBitsPerWord) : dawg(dawg) {
+    if (bloomFilterBitsPerWord > 0) {
+        std::size_t wordCount = 0;
+        dawg->forEachWord([&wordCount](const std::string &) {
+            ++wordCount;
+        });
+
+        auto *filter = new BloomFilter(wordCount, bloomFilterBitsPerWord);
+        dawg->forEachWord([filter](const std::string &word) {
+            filter->add({word.data(), word.length(), 1});
+        });
+
+        bloomFilter.reset(filter);
+    }
+}
+
+bool Lexicon::contains(const std::string &word) const {
+    bool probablyPresent =
+            bloomFilter == nullptr || bloomFilter->mightContain({word.data(), word.length(), 1});
+
+    return probablyPresent && dawg->contains(word);
+}
+
+std::uint64_t Lexicon::findInvalidWords(const std::vector<LetterView> &words) const {
+    std::uint64_t invalid = 0;
+
+    if (bloomFilter == nullptr || words.size() > Dawg::MAX_BATCH_SIZE) {
+        // Oversized batches are left for the graph to reject.
+        invalid = dawg->findMissingWords(words.data(), words.size());
+    } else {
+        // Only words that survive the filter need to be looked up in the graph.
+        LetterView survivors[Dawg::MAX_BATCH_SIZE];
+        std::size_t survivorIndexes[Dawg::MAX_BATCH_SIZE];
+        std::size_t survivorCount = 0;
+
+        for (std::size_t i = 0; i < words.size(); ++i) {
+            if (bloomFilter->mightContain(words[i])) {
+                survivors[survivorCount] = words[i];
+                survivorIndexes[survivorCount] = i;
+                ++survivorCount;
+            } else {
+                invalid |= std::uint64_t(1) << i;
+            }
+        }
+
+        std::uint64_t missing = dawg->findMissingWords(survivors, survivorCount);
+        for (std::size_t i = 0; i < survivorCount; ++i) {
+            if ((missing >> i) & 1u) {
+                invalid |= std::uint64_t(1) << survivorIndexes[i];
+            }
+        }
+    }
+
+    return invalid;
+}
+
+LetterMask Lexicon::findFillers(const LetterView &before, const LetterView &after) const {
+    std::uint32_t node = dawg->root();
+
+    for (std::size_t i = 0; i < before.length && node != Dawg::NONE; ++i) {
+        std::uint32_t edge = dawg->findEdge(node, letterCodeOf(before[i]));
+        node = edge == Dawg::NONE ? Dawg::NONE : dawg->getChild(edge);
+    }
+
+    LetterMask fillers = 0;
+    bool moreEdges = node != Dawg::NONE;
+
+    // Try every letter that can follow before, and see whether after finishes a word from it.
+    for (std::uint32_t filler = node; moreEdges; ++filler) {
+        std::uint32_t edge = filler;
+
+        for (std::size_t i = 0; i < after.length && edge != Dawg::NONE; ++i) {
+            edge = dawg->findEdge(dawg->getChild(edge), letterCodeOf(after[i]));
+        }
+
+        if (edge != Dawg::NONE && dawg->isWordEnd(edge)) {
+            fillers |= LetterMask(1) << dawg->getLetterCode(filler);
+        }
+
+        moreEdges = !dawg->isLastEdge(filler);
+    }
+
+    return fillers;
+}
+
+const Dawg &Lexicon::getDawg() const {
+    return *dawg;
+}
+
+const AnagramIndex &Lexicon::getAnagramIndex() const {
+    std::call_once(anagramIndexBuilt, [this]() {
+        anagramIndex.reset(new AnagramIndex(*dawg));
+    });
+
+    return *anagramIndex;
+}
+
+const std::vector<std::uint32_t> &Lexicon::getWordLengths() const {
+    std::call_once(wordLengthsBuilt, [this]() {
+        std::vector<bool> filled(dawg->edgeCount(), false);
+        wordLengths.assign(dawg->edgeCount(), 0);
+        fillWordLengths(*dawg, dawg->root(), wordLengths, filled);
+    });
+
+    return wordLengths;
+}
+
+PatternIterator Lexicon::findMatches(const std::string &pattern) const {
+    return PatternIterator(*dawg, pattern, &getWordLengths());
+}
+
+PatternIterator Lexicon::findMatches(std::vector<LetterMask> allowedLetters) const {
+    return PatternIterator(*dawg, std::move(allowedLetters), &getWordLengths());
+}
@@ -0,0 +1,87 @@
+#ifndef ASSIGNMENT_2_NEW_LEXICON_H
+#define ASSIGNMENT_2_NEW_LEXICON_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include "Dawg.h"
+#include "AnagramIndex.h"
+#include "BloomFilter.h"
+#include "PatternIterator.h"
+
+/*
+ * A loaded words list, along with the indexes built over it. A Lexicon never changes once it has
+ * been loaded, so a single copy can safely be shared by every game and thread in the process
+ * (see LexiconRegistry).
+ *
+ * Indexes that only some features need are built the first time they are asked for, rather than
+ * slowing down every load. The exception is the optional Bloom filter, which sits in front of
+ * every lookup, and so is built along with the Lexicon itself.
+ */
+class Lexicon {
+public:
+    /*
+     * Takes ownership of the graph. If bloomFilterBitsPerWord is above 0, a Bloom filter of that
+     * many bits per word is built (see BloomFilter), and used to reject most non-words before
+     * they reach the graph. More bits cost more memory but let fewer non-words through.
+     */
+    explicit Lexicon(Dawg *dawg, int bloomFilterBitsPerWord = 0);
+
+    Lexicon(const Lexicon &other) = delete;
+
+    Lexicon &operator=(const Lexicon &other) = delete;
+
+    // Returns whether the word (in either case) is in the words list.
+    bool contains(const std::string &word) const;
+
+    /*
+     * Checks a batch of words (in either case) at once, such as every word formed by a move (see
+     * Dawg::findMissingWords()).
+     *
+     * Returns a bitmask in which bit i is set if words[i] is NOT in the words list.
+     */
+    std::uint64_t findInvalidWords(const std::vector<LetterView> &words) const;
+
+    /*
+     * Returns the letters that can go between before and after (either of which may be empty) to
+     * spell a word, such as the letters that may be placed on a square between two runs of tiles.
+     * The graph is walked once for before, and then once for after below each letter that can
+     * follow it, so nothing is allocated.
+     */
+    LetterMask findFillers(const LetterView &before, const LetterView &after) const;
+
+    // Returns the underlying graph, for walking the words list letter by letter.
+    const Dawg &getDawg() const;
+
+    // Returns the anagram index, building it on first use (thread-safe).
+    const AnagramIndex &getAnagramIndex() const;
+
+    /*
+     * Returns, for every edge of the graph, the lengths of the words that continue through it:
+     * bit k is set if a word ends exactly k letters after the edge (bit 0 meaning at the edge
+     * itself). Built on first use (thread-safe).
+     */
+    const std::vector<std::uint32_t> &getWordLengths() const;
+
+    /*
+     * Returns an iterator over every word matching the pattern (see PatternIterator), which skips
+     * any branch of the graph without words of the pattern's length.
+     */
+    PatternIterator findMatches(const std::string &pattern) const;
+
+    // As above, but with the set of letters allowed at each position given directly.
+    PatternIterator findMatches(std::vector<LetterMask> allowedLetters) const;
+
+private:
+    std::unique_ptr<const Dawg> dawg;
+    // nullptr if disabled.
+    std::unique_ptr<const BloomFilter> bloomFilter;
+
+    mutable std::once_flag anagramIndexBuilt;
+    mutable std::unique_ptr<const AnagramIndex> anagramIndex;
+
+    mutable std::once_flag wordLengthsBuilt;
+    mutable std::vector<std::uint32_t> wordLengths;
+};
+
+#endif //ASSIGNMENT_2_NEW_LEXICON_H
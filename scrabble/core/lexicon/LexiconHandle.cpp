@@ -0,0 +1,17 @@
+#include "LexiconHandle.h"
+#include <stdexcept>
+
+LexiconHandle::LexiconHandle(std::string id, std::shared_ptr<const Load> load)
+        : id(std::move(id)), load(std::move(load)) {}
+
+const Lexicon &LexiconHandle::get() const {
+    if (load == nullptr) {
+        throw std::runtime_error("No words list was loaded for this game!");
+    }
+
+    return *load->lexicon.get();
+}
+
+const std::string &LexiconHandle::getId() const {
+    return id;
+}
@@ -0,0 +1,50 @@
+#ifndef ASSIGNMENT_2_NEW_LEXICONHANDLE_H
+#define ASSIGNMENT_2_NEW_LEXICONHANDLE_H
+
+#include <future>
+#include <memory>
+#include <string>
+#include "Lexicon.h"
+
+/*
+ * A reference counted handle to an immutable words list, which may still be loading on a worker
+ * thread. Handles are obtained from the LexiconRegistry, which makes sure that every handle to
+ * the same file (from any number of games) shares a single load and a single copy in memory.
+ * The words list is freed once the last handle to it is destroyed.
+ *
+ * The load is kicked off as early as possible (i.e., as soon as the program starts), and only
+ * waited on the first time the words are actually needed, so that it overlaps with the menu and
+ * player setup rather than delaying them. Handles are cheap to copy, and are safe to use from
+ * multiple threads, since the words list is never modified once loaded.
+ */
+class LexiconHandle {
+public:
+    // An empty handle, for games that never validate words. Calling get() on it throws.
+    LexiconHandle() = default;
+
+    /*
+     * Returns the loaded words list, blocking until the load has finished if it is still in
+     * progress. Only the first call can ever block.
+     *
+     * Rethrows the runtime error that the load failed with, if it failed.
+     */
+    const Lexicon &get() const;
+
+    // Returns the identifier the words list was acquired under, or an empty string if empty.
+    const std::string &getId() const;
+
+private:
+    friend class LexiconRegistry;
+
+    // The state of a single load, shared by every handle to the same words list.
+    struct Load {
+        std::shared_future<std::unique_ptr<const Lexicon> > lexicon;
+    };
+
+    LexiconHandle(std::string id, std::shared_ptr<const Load> load);
+
+    std::string id;
+    std::shared_ptr<const Load> load;
+};
+
+#endif //ASSIGNMENT_2_NEW_LEXICONHANDLE_H
@@ -0,0 +1,169 @@
+#include "LexiconRegistry.h"
+#include <climits>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include <sys/stat.h>
+#include "DawgBuilder.h"
+#include "DictionaryImage.h"
+#include "../../utility/utils.h"
+
+LexiconRegistry &LexiconRegistry::getInstance() {
+    // Thread-safe initialisation is guaranteed for function-local statics.
+    static LexiconRegistry registry;
+    return registry;
+}
+
+void LexiconRegistry::registerLexicon(const std::string &id, const std::string &wordsListPath,
+                                      int bloomFilterBitsPerWord) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (registrations.find(id) == registrations.end()) {
+        registrationOrder.push_back(id);
+    }
+    registrations[id] = {wordsListPath, bloomFilterBitsPerWord};
+}
+
+void LexiconRegistry::registerLexicons(const std::string &lexiconsFilePath,
+                                       int defaultBloomFilterBitsPerWord) {
+    utils::fileExistsElseThrow(lexiconsFilePath);
+
+    // Words list paths are relative to the directory holding the lexicons file.
+    std::string directory;
+    std::size_t lastSlash = lexiconsFilePath.find_last_of('/');
+    if (lastSlash != std::string::npos) {
+        directory = lexiconsFilePath.substr(0, lastSlash + 1);
+    }
+
+    std::ifstream LexiconsFile(lexiconsFilePath);
+    std::string line;
+
+    while (std::getline(LexiconsFile, line)) {
+        auto args = utils::splitString(line, " ");
+
+        int bloomFilterBitsPerWord = defaultBloomFilterBitsPerWord;
+        bool validLine = args->size() == 2 || args->size() == 3;
+
+        // Lines with a malformed bits column are skipped, like any other malformed line.
+        if (validLine && args->size() == 3) {
+            try {
+                std::size_t parsed;
+                bloomFilterBitsPerWord = std::stoi((*args)[2], &parsed);
+                validLine = parsed == (*args)[2].length() && bloomFilterBitsPerWord >= 0;
+            } catch (std::logic_error &notANumber) {
+                validLine = false;
+            }
+        }
+
+        if (validLine) {
+            registerLexicon((*args)[0], directory + (*args)[1], bloomFilterBitsPerWord);
+        }
+
+        delete args;
+    }
+
+    LexiconsFile.close();
+}
+
+std::vector<std::string> LexiconRegistry::getLexiconIds() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return registrationOrder;
+}
+
+std::string LexiconRegistry::getDefaultLexiconId() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return registrationOrder.empty() ? std::string() : registrationOrder.front();
+}
+
+LexiconHandle LexiconRegistry::acquire(const std::string &id) {
+    Registration registration;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = registrations.find(id);
+
+        if (found == registrations.end()) {
+            throw std::runtime_error("The words list \"" + id + "\" is not registered!");
+        }
+        registration = found->second;
+    }
+
+    const std::string &wordsListPath = registration.wordsListPath;
+    int bloomFilterBitsPerWord = registration.bloomFilterBitsPerWord;
+
+    if (!utils::doesFileExist(DictionaryImage::imagePathFor(wordsListPath))) {
+        utils::fileExistsElseThrow(wordsListPath);
+    }
+
+    std::string key = fileIdentityOf(wordsListPath);
+
+    // This identifier's previous load, which is let go of (if it is no longer its file's) only
+    // once the lock is released, since letting go of a load may wait for it to finish loading.
+    std::shared_ptr<const LexiconHandle::Load> previousLoad;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (auto entry = loads.begin(); entry != loads.end();) {
+        if (entry->second.expired()) {
+            entry = loads.erase(entry);
+        } else {
+            ++entry;
+        }
+    }
+
+    std::shared_ptr<const LexiconHandle::Load> load = loads[key].lock();
+
+    // Nobody holds this words list (or it was never loaded), so start a fresh load.
+    if (load == nullptr) {
+        auto newLoad = std::make_shared<LexiconHandle::Load>();
+        newLoad->lexicon = std::async(std::launch::async, [wordsListPath, bloomFilterBitsPerWord]() {
+            return std::unique_ptr<const Lexicon>(
+                    new Lexicon(readInWordsList(wordsListPath), bloomFilterBitsPerWord));
+        }).share();
+
+        load = newLoad;
+        loads[key] = load;
+    }
+    previousLoad = retainedLoads[id];
+    retainedLoads[id] = load;
+
+    return LexiconHandle(id, load);
+}
+
+std::string LexiconRegistry::fileIdentityOf(const std::string &wordsListPath) {
+    std::string path = wordsListPath;
+    if (!utils::doesFileExist(path)) {
+        path = DictionaryImage::imagePathFor(wordsListPath);
+    }
+
+    // Fall back to the path as given if it cannot be resolved.
+    std::string identity = path;
+    char *resolved = realpath(path.c_str(), nullptr);
+    if (resolved != nullptr) {
+        identity = std::string(resolved);
+        free(resolved);
+    }
+
+    struct stat fileInfo{};
+    if (stat(path.c_str(), &fileInfo) == 0) {
+        identity += "|" + std::to_string(fileInfo.st_dev) + ":" + std::to_string(fileInfo.st_ino) +
+                    ":" + std::to_string(fileInfo.st_size) + ":" +
+                    std::to_string(fileInfo.st_mtime);
+    }
+
+    return identity;
+}
+
+Dawg *LexiconRegistry::readInWordsList(const std::string &path) {
+    Dawg *wordsList;
+
+    try {
+        wordsList = DictionaryImage::map(DictionaryImage::imagePathFor(path), path);
+    } catch (std::runtime_error &missingOrCorruptImage) {
+        // No usable image (i.e., DictionaryCompiler has not been run since the words list last
+        // changed), so parse the text instead.
+        wordsList = DawgBuilder::buildFromWordsFile(path);
+    }
+
+    return wordsList;
+}
@@ -0,0 +1,113 @@
+#ifndef ASSIGNMENT_2_NEW_LEXICONREGISTRY_H
+#define ASSIGNMENT_2_NEW_LEXICONREGISTRY_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "LexiconHandle.h"
+
+/*
+ * The process-wide registry of words lists. Words lists are registered under an identifier (i.e.,
+ * "official", or a house list), which is what games pick and what saved games record. Any number
+ * of games (on any number of threads) can acquire the same words list, and will share one copy of
+ * it, which is loaded at most once for as long as any game still holds a handle to it. Each words
+ * list loads on its own worker thread, so a game never waits on a words list it is not using.
+ *
+ * The registry also holds onto the copy last acquired under each identifier, so that a words list
+ * is not freed and loaded all over again between games. A copy of a file that has since changed
+ * is let go the next time its identifier is acquired, and freed once no game holds it.
+ */
+class LexiconRegistry {
+public:
+    // Returns the single, process-wide registry.
+    static LexiconRegistry &getInstance();
+
+    LexiconRegistry(const LexiconRegistry &other) = delete;
+
+    LexiconRegistry &operator=(const LexiconRegistry &other) = delete;
+
+    /*
+     * Registers the words list at the given path under an identifier. The first words list
+     * registered becomes the default, which is used by saved games that do not record one.
+     *
+     * Registering an identifier again points it at the new file (i.e., an updated list), which
+     * games acquiring it from then on will get. The same goes for a file that is changed on disk,
+     * even if it keeps its path. Games that already hold a handle keep the words list they were
+     * given.
+     *
+     * bloomFilterBitsPerWord sizes the optional Bloom filter put in front of lookups (0 disables
+     * it, see Lexicon). Since a file is only ever loaded once, this only takes effect if the file
+     * is not already loaded.
+     */
+    void registerLexicon(const std::string &id, const std::string &wordsListPath,
+                         int bloomFilterBitsPerWord = 0);
+
+    /*
+     * Registers every words list named in a lexicons file, in which each line holds an identifier,
+     * the path to its words list (relative to the lexicons file) and, optionally, the Bloom filter
+     * bits per word to load it with, separated by spaces (i.e., "official words.txt 10"). Lines
+     * without bits use defaultBloomFilterBitsPerWord.
+     *
+     * Throws a runtime error if the lexicons file does not exist.
+     */
+    void registerLexicons(const std::string &lexiconsFilePath,
+                          int defaultBloomFilterBitsPerWord = 0);
+
+    // Returns the identifiers of every registered words list, in the order they were registered.
+    std::vector<std::string> getLexiconIds();
+
+    // Returns the identifier of the default words list, or an empty string if none are registered.
+    std::string getDefaultLexiconId();
+
+    /*
+     * Returns a handle to the words list registered under the given identifier. If its file is
+     * not already loaded, it starts loading on a worker thread and the handle is returned straight
+     * away; otherwise the existing (possibly still loading) copy is shared, even if it was
+     * acquired under a different identifier.
+     *
+     * Throws a runtime error immediately if the identifier is not registered, or if neither the
+     * words list nor its compiled image exist, so that this is still reported before the game
+     * starts.
+     */
+    LexiconHandle acquire(const std::string &id);
+
+private:
+    // Where a registered words list lives, and how it should be loaded.
+    struct Registration {
+        std::string wordsListPath;
+        int bloomFilterBitsPerWord;
+    };
+
+    LexiconRegistry() = default;
+
+    /*
+     * Loads a words list synchronously. The precompiled dictionary image next to it is memory
+     * mapped if it exists, and the text file is only parsed if it does not.
+     */
+    static Dawg *readInWordsList(const std::string &path);
+
+    /*
+     * Identifies the current contents of a words list by its canonical path, along with its
+     * device, inode, size and modification time (to the second), so that a file that is edited or
+     * replaced keeps its path but not its identity. If only the compiled image exists, the image is identified
+     * instead.
+     */
+    static std::string fileIdentityOf(const std::string &wordsListPath);
+
+    // Guards registrations and loads, since games may acquire words lists from several threads.
+    std::mutex mutex;
+    std::map<std::string, Registration> registrations;
+    std::vector<std::string> registrationOrder;
+    /*
+     * Keyed by file identity, so that different spellings of the same path share a load, but a
+     * changed file never shares the load of its old contents. Loads nobody holds any more are
+     * swept out on every acquire, so edits to a words list do not pile up keys.
+     */
+    std::map<std::string, std::weak_ptr<const LexiconHandle::Load> > loads;
+    // The load last acquired under each identifier, keeping it loaded between games.
+    std::map<std::string, std::shared_ptr<const LexiconHandle::Load> > retainedLoads;
+};
+
+#endif //ASSIGNMENT_2_NEW_LEXICONREGISTRY_H
@@ -0,0 +1,105 @@
+#include "PatternIterator.h"
+#include <stdexcept>
+
+// Returns the allowed letters for a single character of a string pattern.
+static LetterMask maskForPatternChar(char c) {
+    LetterMask mask;
+
+    if (c == '?') {
+        mask = ANY_LETTER;
+    } else if (letterCodeOf(c) != NO_LETTER) {
+        mask = 1u << letterCodeOf(c);
+    } else {
+        throw std::invalid_argument(
+                "Patterns may only contain letters and '?', not '" + std::string(1, c) + "'!");
+    }
+
+    return mask;
+}
+
+// Converts a string pattern into its per-position letter masks.
+static std::vector<LetterMask> masksForPattern(const std::string &pattern) {
+    std::vector<LetterMask> masks;
+
+    for (char c: pattern) {
+        masks.push_back(maskForPatternChar(c));
+    }
+
+    return masks;
+}
+
+PatternIterator::PatternIterator(const Dawg &dawg, const std::string &pattern,
+                                 const std::vector<std::uint32_t> *wordLengths)
+        : PatternIterator(dawg, masksForPattern(pattern), wordLengths) {}
+
+PatternIterator::PatternIterator(const Dawg &dawg, std::vector<LetterMask> allowedLetters,
+                                 const std::vector<std::uint32_t> *wordLengths)
+        : dawg(dawg), wordLengths(wordLengths), allowedLetters(std::move(allowedLetters)),
+          activeDepths(0) {
+    cursors.assign(this->allowedLetters.size(), Dawg::NONE);
+    word.assign(this->allowedLetters.size(), ' ');
+
+    if (!this->allowedLetters.empty()) {
+        enterNode(0, dawg.root());
+        activeDepths = 1;
+    }
+}
+
+void PatternIterator::enterNode(std::size_t depth, std::uint32_t node) {
+    LetterMask allowed = allowedLetters[depth];
+
+    // A fixed letter can be jumped to directly, rather than testing every edge of the node.
+    if (allowed != 0 && (allowed & (allowed - 1)) == 0) {
+        int letter = 0;
+        while ((allowed >> letter) != 1) {
+            ++letter;
+        }
+        cursors[depth] = dawg.findEdge(node, letter);
+    } else {
+        cursors[depth] = node;
+    }
+}
+
+bool PatternIterator::next() {
+    bool found = false;
+
+    while (activeDepths > 0 && !found) {
+        std::size_t depth = activeDepths - 1;
+        std::uint32_t edge = cursors[depth];
+
+        if (edge == Dawg::NONE) {
+            // This depth has been exhausted, so backtrack.
+            --activeDepths;
+        } else {
+            LetterMask allowed = allowedLetters[depth];
+            bool fixedLetter = (allowed & (allowed - 1)) == 0;
+            // Fixed letters only ever have the one edge to try.
+            cursors[depth] = fixedLetter || dawg.isLastEdge(edge) ? Dawg::NONE : edge + 1;
+
+            if ((allowed & (1u << dawg.getLetterCode(edge))) != 0 && canReachPatternEnd(edge, depth)) {
+                word[depth] = dawg.getLetter(edge);
+
+                if (depth == allowedLetters.size() - 1) {
+                    found = dawg.isWordEnd(edge);
+                } else if (dawg.getChild(edge) != Dawg::NONE) {
+                    enterNode(depth + 1, dawg.getChild(edge));
+                    ++activeDepths;
+                }
+            }
+        }
+    }
+
+    return found;
+}
+
+bool PatternIterator::canReachPatternEnd(std::uint32_t edge, std::size_t depth) const {
+    std::size_t lettersLeft = allowedLetters.size() - 1 - depth;
+
+    // Lengths past the end of the mask are not tracked, so they cannot be ruled out.
+    return wordLengths == nullptr || lettersLeft >= 32 ||
+           (((*wordLengths)[edge] >> lettersLeft) & 1u) != 0;
+}
+
+const std::string &PatternIterator::getWord() const {
+    return word;
+}
@@ -0,0 +1,74 @@
+#ifndef ASSIGNMENT_2_NEW_PATTERNITERATOR_H
+#define ASSIGNMENT_2_NEW_PATTERNITERATOR_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Dawg.h"
+
+// A set of letters, with bit 0 standing for 'a' through to bit 25 for 'z'.
+typedef std::uint32_t LetterMask;
+
+static const LetterMask ANY_LETTER = (1u << 26) - 1;
+
+/*
+ * Lazily finds every word in a Dawg that matches a pattern of a fixed length, where each position
+ * of the pattern allows a set of letters. Matches are found one at a time (in alphabetical order)
+ * by walking the graph depth first, and any branch whose letter is not allowed at that position
+ * is never explored, so fixed letters prune the search heavily. If the graph's word lengths are
+ * supplied (see Lexicon::getWordLengths()), branches without any words of the pattern's length
+ * are never explored either. Nothing is ever built up besides the current word, so huge result
+ * sets cost no memory.
+ *
+ * Usage:
+ *  PatternIterator matches(dawg, "?A??S");
+ *  while (matches.next()) {
+ *      std::cout << matches.getWord() << std::endl;
+ *  }
+ *
+ * The Dawg (and word lengths) must outlive the iterator.
+ */
+class PatternIterator {
+public:
+    /*
+     * Matches a pattern written as a string, in which '?' stands for any letter and a letter (in
+     * either case) stands for itself (i.e., "?A??S", or "QU???" for 5 letter words starting with
+     * QU).
+     *
+     * Throws an invalid argument error if the pattern contains anything else.
+     */
+    PatternIterator(const Dawg &dawg, const std::string &pattern,
+                    const std::vector<std::uint32_t> *wordLengths = nullptr);
+
+    // Matches a pattern given as the set of letters allowed at each position.
+    PatternIterator(const Dawg &dawg, std::vector<LetterMask> allowedLetters,
+                    const std::vector<std::uint32_t> *wordLengths = nullptr);
+
+    /*
+     * Moves on to the next matching word, returning false once there are no more matches (after
+     * which the iterator stays exhausted).
+     */
+    bool next();
+
+    // Returns the current (lowercase) match. Only valid after next() has returned true.
+    const std::string &getWord() const;
+
+private:
+    // Positions the cursor at the first edge of node worth trying at the given depth.
+    void enterNode(std::size_t depth, std::uint32_t node);
+
+    // Returns whether any word of the pattern's length continues through the edge at this depth.
+    bool canReachPatternEnd(std::uint32_t edge, std::size_t depth) const;
+
+    const Dawg &dawg;
+    // Optional (nullptr if not given).
+    const std::vector<std::uint32_t> *wordLengths;
+    std::vector<LetterMask> allowedLetters;
+    // The next edge to try at each depth (Dawg::NONE once a depth is exhausted).
+    std::vector<std::uint32_t> cursors;
+    // How many levels of cursors are in use (0 once the search is exhausted).
+    std::size_t activeDepths;
+    std::string word;
+};
+
+#endif //ASSIGNMENT_2_NEW_PATTERNITERATOR_H
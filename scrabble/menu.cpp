@@ -2,21 +2,39 @@
 #include <string>
 #include <utility>
 #include <memory>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
 #include "core/Scrabble.h"
+#include "core/lexicon/LexiconRegistry.h"
 
 #define EXIT_SUCCESS    0
 
-// Prints out the main menu options.
-void printMainMenu(bool boardExpansion, bool wordValidation);
+/*
+ * Prints out the main menu options. seedGiven is whether a seed was given on the command line
+ * (in which case it is seed), and boardSize is the size of the board new games are played on.
+ */
+void printMainMenu(const LexiconHandle &wordsList, bool boardExpansion, bool wordValidation,
+                   bool seedGiven, std::uint64_t seed, int boardSize);
 
-// Instantiates a new Scrabble object and begins the game.
-void newGame(const std::string &wordsListPath, bool boardExpansion, bool wordValidation);
+/*
+ * Instantiates a new Scrabble object and begins the game on a boardSize x boardSize board. The
+ * game uses the default words list, unless several are registered, in which case the players
+ * pick one. Its random numbers come from the given seed, or a fresh one if none was given.
+ */
+void newGame(const LexiconHandle &defaultWordsList, bool boardExpansion, bool wordValidation,
+             bool seedGiven, std::uint64_t seed, int boardSize);
 
 /*
  * Instantiates a new Scrabble object, but with pre-defined contents, and starts
- * the game.
+ * the game. Games saved without their random numbers use the given seed (or 0 if none was given,
+ * so that they still play out the same way every time, as they did when they were saved with
+ * the order of their tiles).
  */
-void loadGame(const std::string &wordsListPath, bool boardExpansion, bool wordValidation);
+void loadGame(bool boardExpansion, bool wordValidation, bool seedGiven, std::uint64_t seed);
+
+// Lets the players pick one of the registered words lists, and returns a handle to it.
+LexiconHandle chooseWordsList(const LexiconHandle &defaultWordsList);
 
 // Displays the credits.
 void credits();
@@ -33,35 +51,53 @@ std::string getPlayerName(int playerNum);
 // Validates the given player name, enforcing the capitalisation requirement.
 bool validatePlayerName(const std::string &nameToValidate);
 
-// Read in the official_words_list.txt file and store it in memory for fast access.
-StringVec *readInWordsList(const std::string &path);
-
 // Validates and gets the number of players from the standard input.
 int getValidAmountOfPlayers();
 
 int main(int argc, char **argv) {
     bool boardExpansion = false;
     bool wordValidation = false;
+    bool superBoard = false;
+    bool seedGiven = false;
+    std::uint64_t seed = 0;
+    bool bloomBitsGiven = false;
+    int bloomBits = 0;
     bool invalidInput = false;
 
     // Validate the commandline arguments.
-    if (argc == 3) {
-        std::string arg1 = std::string(argv[1]);
-        std::string arg2 = std::string(argv[2]);
+    for (int i = 1; i < argc && !invalidInput; ++i) {
+        std::string arg = std::string(argv[i]);
 
-        if ((arg1 == "-wordvalidation" || arg1 == "-boardexpansion") &&
-            (arg2 == "-wordvalidation" || arg2 == "-boardexpansion")) {
-            boardExpansion = true;
+        if (arg == "-wordvalidation") {
             wordValidation = true;
-        } else {
-            invalidInput = true;
-        }
-    } else if (argc == 2) {
-        std::string arg1 = std::string(argv[1]);
-        if (arg1 == "-wordvalidation") {
-            wordValidation = true;
-        } else if (arg1 == "-boardexpansion") {
+        } else if (arg == "-boardexpansion") {
             boardExpansion = true;
+        } else if (arg == "-superboard") {
+            superBoard = true;
+        } else if (arg == "-seed" && i + 1 < argc && !seedGiven) {
+            std::string seedArg = std::string(argv[++i]);
+
+            // Only plain (non-negative) numbers are seeds.
+            try {
+                std::size_t parsed;
+                seed = std::stoull(seedArg, &parsed);
+                seedGiven = parsed == seedArg.length() && seedArg[0] != '-';
+            } catch (std::logic_error &notANumber) {
+                seedGiven = false;
+            }
+            invalidInput = !seedGiven;
+        } else if (arg == "-bloombits" && i + 1 < argc && !bloomBitsGiven) {
+            std::string bloomBitsArg = std::string(argv[++i]);
+
+            // The Bloom filter bits per word for words lists that do not set their own (0 = off).
+            try {
+                std::size_t parsed;
+                bloomBits = std::stoi(bloomBitsArg, &parsed);
+                bloomBitsGiven = parsed == bloomBitsArg.length() && bloomBits >= 0;
+            } catch (std::logic_error &notANumber) {
+                bloomBitsGiven = false;
+            }
+            invalidInput = !bloomBitsGiven;
         } else {
             invalidInput = true;
         }
@@ -71,6 +107,7 @@ int main(int argc, char **argv) {
     if (invalidInput) {
         std::cout << "Incorrect command-line arguments. You may choose from the "
                      "following (in any order):\n* [-wordvalidation]\n* [-boardexpansion]"
+                     "\n* [-superboard]\n* [-seed <number>]\n* [-bloombits <number>]"
                   << std::endl;
     } else {
         std::cout << "          Welcome to Scrabble!" << std::endl;
@@ -87,16 +124,42 @@ int main(int argc, char **argv) {
         } else {
             std::cout << "[ENHANCEMENT] > Board Expansion disabled!" << std::endl;
         }
+
+        if (superBoard) {
+            std::cout << "[ENHANCEMENT] > Super Board enabled!" << std::endl;
+        } else {
+            std::cout << "[ENHANCEMENT] > Super Board disabled!" << std::endl;
+        }
         std::cout << "--------------------------------------" << std::endl << std::endl;
 
-        printMainMenu(boardExpansion, wordValidation);
+        /*
+         * Start loading the default words list in the background straight away, so that it is
+         * (usually) ready by the time the players have been set up. Holding onto it also keeps it
+         * loaded for as long as the menu is open. It is only needed for word validation.
+         */
+        LexiconHandle wordsList;
+
+        try {
+            if (wordValidation) {
+                LexiconRegistry &registry = LexiconRegistry::getInstance();
+                registry.registerLexicons("../resources/lexicons.txt", bloomBits);
+                wordsList = registry.acquire(registry.getDefaultLexiconId());
+            }
+
+            // New games are played on a Super Scrabble board if asked for (loaded games keep theirs).
+            int boardSize = superBoard ? Board::SUPER_SIZE : Board::STANDARD_SIZE;
+            printMainMenu(wordsList, boardExpansion, wordValidation, seedGiven, seed, boardSize);
+        } catch (std::runtime_error &e) {
+            std::cout << e.what() << std::endl;
+            gameQuit();
+        }
     }
     return EXIT_SUCCESS;
 }
 
 
-void printMainMenu(bool boardExpansion, bool wordValidation) {
-    std::string wordsListPath = "../resources/official_words_list.txt";
+void printMainMenu(const LexiconHandle &wordsList, bool boardExpansion, bool wordValidation,
+                   bool seedGiven, std::uint64_t seed, int boardSize) {
     std::string selection;
     int menuSelection;
     bool exit = false;
@@ -127,9 +190,10 @@ void printMainMenu(bool boardExpansion, bool wordValidation) {
                     std::cout << "Your choice must be between 1-4 (bounds included)." << std::endl;
                 } else {
                     if (menuSelection == 1) {
-                        newGame(wordsListPath, boardExpansion, wordValidation);
+                        newGame(wordsList, boardExpansion, wordValidation, seedGiven, seed,
+                                boardSize);
                     } else if (menuSelection == 2) {
-                        loadGame(wordsListPath, boardExpansion, wordValidation);
+                        loadGame(boardExpansion, wordValidation, seedGiven, seed);
                     } else if (menuSelection == 3) {
                         credits();
                     }
@@ -150,7 +214,8 @@ void printMainMenu(bool boardExpansion, bool wordValidation) {
     }
 }
 
-void newGame(const std::string &wordsListPath, bool boardExpansion, bool wordValidation) {
+void newGame(const LexiconHandle &defaultWordsList, bool boardExpansion, bool wordValidation,
+             bool seedGiven, std::uint64_t seed, int boardSize) {
     std::cout << std::endl;
     std::cout << "Starting a new game" << std::endl;
     std::cout << "Please enter the number of players (2-4):" << std::endl;
@@ -165,16 +230,20 @@ void newGame(const std::string &wordsListPath, bool boardExpansion, bool wordVal
         players->add(ply);
     }
 
-    Board *board = new Board(15, boardExpansion);
+    LexiconHandle wordsList = defaultWordsList;
+    if (wordValidation && LexiconRegistry::getInstance().getLexiconIds().size() > 1) {
+        wordsList = chooseWordsList(defaultWordsList);
+    }
+
+    Board *board = new Board(boardSize, boardExpansion);
     std::string tilesFile = "../resources/scrabbletiles.txt";
-    Scrabble *game = new Scrabble(players, board, tilesFile,
-                                  readInWordsList(wordsListPath),
-                                  wordValidation);
+    Scrabble *game = new Scrabble(players, board, tilesFile, wordsList, wordValidation,
+                                  seedGiven ? seed : Random::generateSeed());
 
     setupGame(game, false);
 }
 
-void loadGame(const std::string &wordsListPath, bool boardExpansion, bool wordValidation) {
+void loadGame(bool boardExpansion, bool wordValidation, bool seedGiven, std::uint64_t seed) {
     std::cout << std::endl;
     std::cout << "Enter the filename of the game to load:" << std::endl;
 
@@ -192,16 +261,20 @@ void loadGame(const std::string &wordsListPath, bool boardExpansion, bool wordVa
         }
 
         try {
-            game = new Scrabble(filePath, 15,
-                                readInWordsList(wordsListPath), wordValidation,
-                                boardExpansion);
+            game = new Scrabble(filePath, wordValidation, boardExpansion, seedGiven ? seed : 0);
             fileInvalid = false;
-        } catch (std::runtime_error &fileNotFound) {
+        } catch (std::runtime_error &cannotLoad) {
             fileInvalid = true;
-        }
 
-        if (fileInvalid) {
-            std::cout << "\"" << filePath << "\"" << " is not a valid file path!" << std::endl;
+            /*
+             * The file may exist but still not load (i.e., its words list is not registered), in
+             * which case the reason is more use than blaming the path.
+             */
+            if (utils::doesFileExist(filePath)) {
+                std::cout << cannotLoad.what() << std::endl;
+            } else {
+                std::cout << "\"" << filePath << "\"" << " is not a valid file path!" << std::endl;
+            }
         }
 
         std::cout << std::endl;
@@ -212,6 +285,43 @@ void loadGame(const std::string &wordsListPath, bool boardExpansion, bool wordVa
     setupGame(game, true);
 }
 
+LexiconHandle chooseWordsList(const LexiconHandle &defaultWordsList) {
+    std::vector<std::string> ids = LexiconRegistry::getInstance().getLexiconIds();
+
+    std::cout << "Choose a words list (press enter for " << defaultWordsList.getId() << "):"
+              << std::endl;
+    for (const std::string &id: ids) {
+        std::cout << "* " << id << std::endl;
+    }
+
+    LexiconHandle chosen;
+    bool chosenValid = false;
+
+    while (!chosenValid) {
+        std::string id;
+        std::cout << "> ";
+        std::getline(std::cin, id);
+
+        if (std::cin.eof()) {
+            std::cout << std::endl;
+            throw std::runtime_error("Program forcibly quit by user.");
+        }
+
+        if (id.empty()) {
+            chosen = defaultWordsList;
+            chosenValid = true;
+        } else if (std::find(ids.begin(), ids.end(), id) != ids.end()) {
+            // Starts loading it in the background, if no other game is already using it.
+            chosen = LexiconRegistry::getInstance().acquire(id);
+            chosenValid = true;
+        } else {
+            std::cout << "\"" << id << "\" is not one of the words lists!" << std::endl;
+        }
+        std::cout << std::endl;
+    }
+
+    return chosen;
+}
 
 void credits() {
     std::cout << std::endl;
@@ -308,19 +418,3 @@ int getValidAmountOfPlayers() {
 
     return numPlayers;
 }
-
-StringVec *readInWordsList(const std::string &path) {
-    utils::fileExistsElseThrow(path);
-    // Load file.
-    std::ifstream WordsList(path);
-    std::string line;
-
-    StringVec *wordsList = new StringVec();
-
-    while (std::getline(WordsList, line)) {
-        wordsList->push_back(line);
-    }
-    WordsList.close();
-
-    return wordsList;
-}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include "../core/lexicon/DawgBuilder.h"
+#include "../core/lexicon/DictionaryImage.h"
+
+#define EXIT_SUCCESS    0
+#define EXIT_FAILURE    1
+
+/*
+ * Offline dictionary compiler. Turns a plain text words list (one sorted word per line) into a
+ * binary dictionary image, which the game can then memory map at startup instead of parsing the
+ * text file.
+ *
+ * Usage: DictionaryCompiler <words list> [image]
+ *
+ * If no image path is given, the image is written next to the words list with a .dawg extension
+ * (which is where the game looks for it).
+ */
+int main(int argc, char **argv) {
+    if (argc != 2 && argc != 3) {
+        std::cout << "Usage: " << argv[0] << " <words list> [image]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::string wordsListPath = std::string(argv[1]);
+    std::string imagePath = argc == 3 ? std::string(argv[2])
+                                      : DictionaryImage::imagePathFor(wordsListPath);
+
+    try {
+        Dawg *dawg = DawgBuilder::buildFromWordsFile(wordsListPath);
+        DictionaryImage::write(*dawg, imagePath, wordsListPath);
+
+        std::cout << "Compiled \"" << wordsListPath << "\" into \"" << imagePath << "\" ("
+                  << dawg->edgeCount() << " edges)." << std::endl;
+        delete dawg;
+
+        // Read the image back, so that a bad image is caught here rather than at game startup.
+        delete DictionaryImage::map(imagePath, wordsListPath);
+    } catch (std::runtime_error &e) {
+        std::cout << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
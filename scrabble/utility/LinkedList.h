@@ -2,6 +2,7 @@
 #define ASSIGN2_LINKEDLIST_H
 
 #include <iostream>
+#include <functional>
 #include "Node.h"
 #include "../core/Tile.h"
 #include "../contract/Serialisable.h"
@@ -94,13 +95,14 @@ private:
 template<typename T>
 LinkedList<T>::LinkedList() {
     /*
-     * Enforce a template/generics constraint, such that T extends Serialisable,
-     * or in other words, T MUST be a subclass of Serialisable or Serialisable.
+     * Enforce a template/generics constraint, such that T is serialisable (see
+     * IsSerialisable), either by extending Serialisable or by having its own
+     * serialiseToString() method, as plain values such as Tile do.
      * Since this LinkedList is marked serialisable, then its elements must also
      * be serialisable, so that it can correctly be serialised.
      */
-    static_assert(std::is_base_of<Serialisable, T>::value,
-                  "type parameter of this class must derive from Serialisable");
+    static_assert(IsSerialisable<T>::value,
+                  "type parameter of this class must have a serialiseToString() method");
     head = nullptr;
     tail = nullptr;
     length = 0;
@@ -0,0 +1,44 @@
+#include "MappedFile.h"
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string &path) : address(nullptr), length(0) {
+    int fd = open(path.c_str(), O_RDONLY);
+
+    if (fd == -1) {
+        throw std::runtime_error("The filename \"" + path + "\" does not exist!");
+    }
+
+    struct stat fileInfo{};
+    bool mapped = false;
+
+    // Zero-length mappings are not allowed, so an empty file is treated as unmappable.
+    if (fstat(fd, &fileInfo) == 0 && fileInfo.st_size > 0) {
+        length = static_cast<std::size_t>(fileInfo.st_size);
+        address = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+        mapped = address != MAP_FAILED;
+    }
+
+    // The mapping stays valid after the descriptor is closed.
+    close(fd);
+
+    if (!mapped) {
+        address = nullptr;
+        throw std::runtime_error("The file \"" + path + "\" could not be memory mapped!");
+    }
+}
+
+MappedFile::~MappedFile() {
+    munmap(address, length);
+}
+
+const void *MappedFile::data() const {
+    return address;
+}
+
+std::size_t MappedFile::size() const {
+    return length;
+}
@@ -0,0 +1,39 @@
+#ifndef ASSIGNMENT_2_NEW_MAPPEDFILE_H
+#define ASSIGNMENT_2_NEW_MAPPEDFILE_H
+
+#include <string>
+
+/*
+ * A read-only memory mapping of an entire file, which is unmapped on destruction.
+ *
+ * Since the mapping is shared and read-only, every process that maps the same file is served
+ * from the same physical pages in the OS page cache, and nothing is read until it is touched.
+ */
+class MappedFile {
+public:
+    /*
+     * Maps the file at the given path.
+     *
+     * Throws a runtime error if the file does not exist or cannot be mapped.
+     */
+    explicit MappedFile(const std::string &path);
+
+    ~MappedFile();
+
+    // A mapping cannot be shared between two owners, as both would try to unmap it.
+    MappedFile(const MappedFile &other) = delete;
+
+    MappedFile &operator=(const MappedFile &other) = delete;
+
+    // Returns the start of the mapped file contents.
+    const void *data() const;
+
+    // Returns the size of the mapped file, in bytes.
+    std::size_t size() const;
+
+private:
+    void *address;
+    std::size_t length;
+};
+
+#endif //ASSIGNMENT_2_NEW_MAPPEDFILE_H
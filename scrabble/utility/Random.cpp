@@ -0,0 +1,107 @@
+#include "Random.h"
+#include <random>
+#include <stdexcept>
+#include "utils.h"
+
+// Rotates the bits of a value left, wrapping them around.
+static std::uint64_t rotateLeft(std::uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+Random::Random(std::uint64_t seed) : seed(seed) {
+    /*
+     * Spread the seed over the state with splitmix64, which never gives an all zero state (that
+     * xoshiro could not leave), and makes similar seeds give unrelated streams.
+     */
+    std::uint64_t mix = seed;
+
+    for (std::uint64_t &word: state) {
+        mix += 0x9E3779B97F4A7C15ULL;
+        std::uint64_t z = mix;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        word = z ^ (z >> 31);
+    }
+}
+
+Random::~Random() = default;
+
+Random Random::fromString(const std::string &serialisedRandom) {
+    std::vector<std::string> *numbers = utils::splitString(serialisedRandom, " ");
+    bool wellFormed = numbers->size() == 5;
+    Random random;
+
+    try {
+        for (std::size_t i = 0; i < numbers->size() && wellFormed; ++i) {
+            std::uint64_t number = std::stoull((*numbers)[i]);
+
+            if (i == 0) {
+                random.seed = number;
+            } else {
+                random.state[i - 1] = number;
+            }
+        }
+    } catch (std::logic_error &notANumber) {
+        wellFormed = false;
+    }
+
+    delete numbers;
+
+    if (!wellFormed) {
+        throw std::runtime_error("\"" + serialisedRandom + "\" is not a random number generator!");
+    }
+
+    return random;
+}
+
+std::uint64_t Random::generateSeed() {
+    std::random_device device;
+    return (static_cast<std::uint64_t>(device()) << 32) | device();
+}
+
+std::uint64_t Random::getSeed() const {
+    return seed;
+}
+
+std::uint64_t Random::next() {
+    std::uint64_t result = rotateLeft(state[1] * 5, 7) * 9;
+    std::uint64_t shifted = state[1] << 17;
+
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= shifted;
+    state[3] = rotateLeft(state[3], 45);
+
+    return result;
+}
+
+std::uint32_t Random::nextBelow(std::uint32_t bound) {
+    /*
+     * Scale 32 random bits up to the bound (Lemire's method), and reject the few values that
+     * would make the lower numbers come up once more often than the rest.
+     */
+    std::uint64_t scaled = (next() >> 32) * bound;
+
+    // Only values that land this close to the start of a step can be biased, so this is rare.
+    if (static_cast<std::uint32_t>(scaled) < bound) {
+        std::uint32_t threshold = static_cast<std::uint32_t>(-bound) % bound;
+
+        while (static_cast<std::uint32_t>(scaled) < threshold) {
+            scaled = (next() >> 32) * bound;
+        }
+    }
+
+    return static_cast<std::uint32_t>(scaled >> 32);
+}
+
+std::string Random::serialiseToString() {
+    std::string serialisedRandom = std::to_string(seed);
+
+    for (std::uint64_t word: state) {
+        serialisedRandom.append(" ").append(std::to_string(word));
+    }
+
+    return serialisedRandom;
+}
@@ -0,0 +1,53 @@
+#ifndef ASSIGNMENT_2_NEW_RANDOM_H
+#define ASSIGNMENT_2_NEW_RANDOM_H
+
+#include <cstdint>
+#include <string>
+#include "../contract/Serialisable.h"
+
+/*
+ * A seedable pseudo-random number generator (xoshiro256**), owned by whatever needs random
+ * numbers (i.e., one per game) rather than shared, so that no locking is needed and every owner
+ * gets its own stream.
+ *
+ * The same seed always gives the same numbers, so a game can be replayed exactly. Its whole state
+ * can also be serialised, so that a saved game carries on with the very numbers it would have
+ * had, had it not been saved.
+ */
+class Random : public Serialisable {
+public:
+    // Creates a generator whose state is derived from the seed.
+    explicit Random(std::uint64_t seed = 0);
+
+    ~Random() override;
+
+    /*
+     * Restores a generator from its serialised form (see serialiseToString()). Throws a runtime
+     * error if it is malformed.
+     */
+    static Random fromString(const std::string &serialisedRandom);
+
+    // Returns a fresh seed from the operating system's random source.
+    static std::uint64_t generateSeed();
+
+    // Returns the seed the generator was created with.
+    std::uint64_t getSeed() const;
+
+    // Returns the next 64 random bits.
+    std::uint64_t next();
+
+    /*
+     * Returns a number from 0 to bound - 1 (bound must be positive), with every number equally
+     * likely (unlike rand() % bound, which favours the smaller numbers).
+     */
+    std::uint32_t nextBelow(std::uint32_t bound);
+
+    // Serialises the seed, followed by the current state (as five space separated numbers).
+    std::string serialiseToString() override;
+
+private:
+    std::uint64_t seed;
+    std::uint64_t state[4];
+};
+
+#endif //ASSIGNMENT_2_NEW_RANDOM_H
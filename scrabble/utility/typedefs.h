@@ -5,8 +5,6 @@
 #include <vector>
 #include "../core/Tile.h"
 
-typedef std::vector<std::vector<Tile> > BoardGrid;
-
 typedef std::vector<std::string> StringVec;
 
 #endif //ASSIGNMENT_2_TYPEDEFS_H
@@ -41,25 +41,6 @@ std::string utils::toLower(const std::string &toConvert) {
     return newString;
 }
 
-// Gets leftmost index of a word very quickly (non-recursive binary search).
-int utils::getIndexOfWord(std::vector<std::string> *listOfWords, const std::string &word) {
-    int low = 0;
-    int listSize = listOfWords->size();
-    int high = listSize;
-
-    while (low < high) {
-        int midpoint = (low + high) / 2;
-
-        if ((*listOfWords)[midpoint] < word) {
-            low = midpoint + 1;
-        } else {
-            high = midpoint;
-        }
-    }
-
-    return low;
-}
-
 int utils::maximum(int n, int m) {
     return n > m ? n : m;
 }
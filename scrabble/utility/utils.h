@@ -47,16 +47,6 @@ namespace utils {
      */
     std::string toLower(const std::string &toConvert);
 
-    /*
-     * Given a list of strings (listOfWords) and a string to find (word), find the index of that
-     * string's occurrence in that list. This function utilises a non-recursive binary search, which
-     * was designed to be as efficient as possible. In mathematical terms, it will continually bisect
-     * the list, searching for the left-most occurrence of the word (in-case there are duplicates -
-     * there are no duplicates in the provided list, as I have lowercased them all and removed all
-     * dupes for maximum efficiency).
-     */
-    int getIndexOfWord(std::vector<std::string> *listOfWords, const std::string &word);
-
     // Given two numbers, n and m, returns the maximum of those two numbers.
     int maximum(int n, int m);
 
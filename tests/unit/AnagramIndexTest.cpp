@@ -0,0 +1,134 @@
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <set>
+#include <string>
+#include <vector>
+#include "UnitTest.h"
+#include "../../scrabble/core/lexicon/DawgBuilder.h"
+#include "../../scrabble/core/lexicon/Lexicon.h"
+
+/*
+ * Checks the anagram index against a brute-force scan of the words list: for a rack (with and
+ * without a blank), the index must visit exactly the words the scan finds, each of them once.
+ *
+ * Usage: AnagramIndexTest <words list>
+ */
+
+typedef std::array<int, 26> LetterCounts;
+
+static const char BLANK = '?';
+
+static LetterCounts countLetters(const std::string &letters) {
+    LetterCounts counts{};
+    for (char letter: letters) {
+        if (std::isalpha(static_cast<unsigned char>(letter))) {
+            ++counts[std::tolower(static_cast<unsigned char>(letter)) - 'a'];
+        }
+    }
+    return counts;
+}
+
+// Returns whether the word can be spelt from the rack, with each blank standing in for any letter.
+static bool canSpell(const std::string &word, const std::string &rack, bool useEveryTile) {
+    LetterCounts wordCounts = countLetters(word);
+    LetterCounts rackCounts = countLetters(rack);
+    int blanks = static_cast<int>(std::count(rack.begin(), rack.end(), BLANK));
+    int shortfall = 0;
+
+    for (int letter = 0; letter < 26; ++letter) {
+        shortfall += std::max(0, wordCounts[letter] - rackCounts[letter]);
+    }
+
+    return shortfall <= blanks && (!useEveryTile || word.length() == rack.length());
+}
+
+static std::vector<std::string> scan(const std::vector<std::string> &wordsList,
+                                     const std::string &rack, bool useEveryTile) {
+    std::vector<std::string> found;
+    for (const auto &word: wordsList) {
+        if (canSpell(word, rack, useEveryTile)) {
+            found.push_back(word);
+        }
+    }
+    std::sort(found.begin(), found.end());
+    return found;
+}
+
+/*
+ * Asks the index for the rack's words, trying every letter in place of a blank (the index itself
+ * only knows about letters). Words that need no blank turn up once per substitution, so they are
+ * only counted once, but a word visited twice for the same substitution is kept as a duplicate.
+ */
+static std::vector<std::string> query(const AnagramIndex &index, const std::string &rack,
+                                      bool useEveryTile) {
+    std::set<std::string> found;
+    std::vector<std::string> duplicates;
+    std::size_t blank = rack.find(BLANK);
+    // Without a blank, a single pass with the rack as it is (the substitute is never used).
+    std::string substitutes = blank == std::string::npos ? "-" : "abcdefghijklmnopqrstuvwxyz";
+
+    for (char substitute: substitutes) {
+        std::string letters = rack;
+        if (blank != std::string::npos) {
+            letters[blank] = substitute;
+        }
+
+        std::vector<std::string> visited;
+        auto collect = [&visited](const char *word, std::size_t length) {
+            visited.emplace_back(word, length);
+        };
+        if (useEveryTile) {
+            index.forEachAnagram(letters, collect);
+        } else {
+            index.forEachWordFrom(letters, collect);
+        }
+
+        std::sort(visited.begin(), visited.end());
+        for (std::size_t i = 0; i < visited.size(); ++i) {
+            if (i > 0 && visited[i] == visited[i - 1]) {
+                duplicates.push_back(visited[i]);
+            }
+            found.insert(visited[i]);
+        }
+    }
+
+    std::vector<std::string> words(found.begin(), found.end());
+    words.insert(words.end(), duplicates.begin(), duplicates.end());
+    std::sort(words.begin(), words.end());
+    return words;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        std::cout << "Usage: " << argv[0] << " <words list>" << std::endl;
+        return 1;
+    }
+
+    std::vector<std::string> wordsList = unittest::readWordsList(argv[1]);
+    Lexicon lexicon(DawgBuilder::buildFromWordsFile(argv[1]));
+    const AnagramIndex &index = lexicon.getAnagramIndex();
+
+    // The same index is handed back every time.
+    CHECK(&index == &lexicon.getAnagramIndex());
+
+    for (const std::string rack: {"AEINRST", "aeinrst", "AEINRS?", "QZ", "?", ""}) {
+        for (bool useEveryTile: {true, false}) {
+            std::vector<std::string> expected = scan(wordsList, rack, useEveryTile);
+            std::vector<std::string> actual = query(index, rack, useEveryTile);
+
+            if (expected != actual) {
+                std::cout << "Rack \"" << rack << "\" (" << (useEveryTile ? "anagrams" : "subsets")
+                          << "): expected " << expected.size() << " words, got " << actual.size()
+                          << std::endl;
+            }
+            CHECK(expected == actual);
+        }
+    }
+
+    // Sanity check the scan itself, so that two empty results cannot agree by accident.
+    CHECK(!scan(wordsList, "AEINRST", true).empty());
+    CHECK(std::binary_search(wordsList.begin(), wordsList.end(), std::string("stainer")));
+
+    return unittest::finish();
+}
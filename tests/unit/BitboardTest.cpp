@@ -0,0 +1,84 @@
+#include <random>
+#include "UnitTest.h"
+#include "../../scrabble/core/gameboard/Bitboard.h"
+
+/*
+ * Checks Bitboard's whole-board operations against plain square-by-square scans, over random
+ * boards of every size (including the standard and Super Scrabble sizes, which neighbours() has
+ * its own copies of the loop for).
+ */
+
+// Returns whether a square is on the board and set.
+static bool isSet(const Bitboard &board, int row, int col) {
+    return row >= 0 && col >= 0 && row < board.size() && col < board.size() &&
+           board.test(row, col);
+}
+
+static void checkAgainstScan(const Bitboard &board) {
+    int size = board.size();
+    Bitboard neighbours = board.neighbours();
+    Bitboard transposed = board.transposed();
+    Bitboard inverted = ~board;
+    int count = 0;
+
+    for (int row = 0; row < size; ++row) {
+        for (int col = 0; col < size; ++col) {
+            bool set = board.test(row, col);
+            bool nextToSet = isSet(board, row - 1, col) || isSet(board, row + 1, col) ||
+                             isSet(board, row, col - 1) || isSet(board, row, col + 1);
+            count += set ? 1 : 0;
+
+            CHECK(((board.getRow(row) >> col) & 1u) == (set ? 1u : 0u));
+            CHECK(neighbours.test(row, col) == nextToSet);
+            CHECK(board.hasNeighbour(row, col) == nextToSet);
+            CHECK(transposed.test(col, row) == set);
+            CHECK(inverted.test(row, col) == !set);
+        }
+
+        // Nothing is ever set outside of the board (a full width lane has no bits outside it).
+        if (size < Bitboard::MAX_SIZE) {
+            CHECK((neighbours.getRow(row) >> size) == 0);
+            CHECK((inverted.getRow(row) >> size) == 0);
+        }
+    }
+
+    CHECK(board.count() == count);
+    CHECK(board.none() == (count == 0));
+    CHECK(transposed.transposed() == board);
+    CHECK((board & inverted).none());
+    CHECK((board | inverted).count() == size * size);
+}
+
+int main() {
+    std::mt19937 random(2022);
+
+    for (int size = 1; size <= Bitboard::MAX_SIZE; ++size) {
+        // From empty, through sparse, to full.
+        for (int percentSet: {0, 5, 30, 70, 100}) {
+            Bitboard board(size);
+            for (int row = 0; row < size; ++row) {
+                for (int col = 0; col < size; ++col) {
+                    if (static_cast<int>(random() % 100) < percentSet) {
+                        board.set(row, col);
+                    }
+                }
+            }
+            checkAgainstScan(board);
+
+            // Equality sees a single square of difference, in either direction.
+            Bitboard changed = board;
+            CHECK(changed == board);
+            if (board.test(0, size - 1)) {
+                changed.reset(0, size - 1);
+            } else {
+                changed.set(0, size - 1);
+            }
+            CHECK(!(changed == board));
+        }
+    }
+
+    // Boards of different sizes are never equal, even if neither has anything set.
+    CHECK(!(Bitboard(15) == Bitboard(21)));
+
+    return unittest::finish();
+}
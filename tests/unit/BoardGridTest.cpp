@@ -0,0 +1,137 @@
+#include <random>
+#include "UnitTest.h"
+#include "../../scrabble/core/gameboard/BoardGrid.h"
+
+/*
+ * Checks that the bookkeeping a BoardGrid keeps as tiles come and go (its tile count, occupied
+ * squares, anchors, per-line counts and bounding box) always agrees with a plain scan of its
+ * letters.
+ */
+
+// Returns whether a square is on the board and holds a tile.
+static bool holdsTile(const BoardGrid &grid, int row, int col) {
+    return row >= 0 && col >= 0 && row < grid.size() && col < grid.size() &&
+           grid.getLetter(row, col) != BoardGrid::EMPTY;
+}
+
+// Compares everything the grid keeps track of with a scan of every square.
+static void checkAgainstScan(const BoardGrid &grid) {
+    int size = grid.size();
+    int tileCount = 0;
+    int topRow = -1;
+    int bottomRow = -1;
+    int leftColumn = -1;
+    int rightColumn = -1;
+
+    Bitboard anchors = grid.getAnchors();
+
+    for (int row = 0; row < size; ++row) {
+        LineMask rowMask = 0;
+        int rowCount = 0;
+        int columnCount = 0;
+
+        for (int col = 0; col < size; ++col) {
+            bool occupied = holdsTile(grid, row, col);
+            bool nextToTile = holdsTile(grid, row - 1, col) || holdsTile(grid, row + 1, col) ||
+                              holdsTile(grid, row, col - 1) || holdsTile(grid, row, col + 1);
+            rowCount += occupied ? 1 : 0;
+            // The scan reads row as a column here, so the transposed copy is read the same way.
+            columnCount += holdsTile(grid, col, row) ? 1 : 0;
+
+            if (occupied) {
+                ++tileCount;
+                rowMask |= LineMask(1) << col;
+                topRow = topRow == -1 ? row : topRow;
+                bottomRow = row;
+                leftColumn = leftColumn == -1 || col < leftColumn ? col : leftColumn;
+                rightColumn = col > rightColumn ? col : rightColumn;
+            }
+
+            CHECK(grid.getOccupied().test(row, col) == occupied);
+            CHECK(grid.getOccupiedTransposed().test(col, row) == occupied);
+            CHECK(anchors.test(row, col) == (!occupied && nextToTile));
+            CHECK(grid.hasNeighbour(row, col) == nextToTile);
+            CHECK(grid.getLine(Direction::VERTICAL, col)[row] == grid.getLetter(row, col));
+        }
+
+        CHECK(grid.getRowMask(row) == rowMask);
+        CHECK(grid.getRowCount(row) == rowCount);
+        CHECK(grid.getColumnCount(row) == columnCount);
+    }
+
+    CHECK(grid.getOccupied().count() == tileCount);
+    CHECK(grid.getOccupied().none() == (tileCount == 0));
+    CHECK(grid.getOccupied().transposed() == grid.getOccupiedTransposed());
+    CHECK(grid.getOccupiedTransposed().transposed() == grid.getOccupied());
+
+    CHECK(grid.getTileCount() == tileCount);
+    CHECK(grid.getTopRow() == topRow);
+    CHECK(grid.getBottomRow() == bottomRow);
+    CHECK(grid.getLeftColumn() == leftColumn);
+    CHECK(grid.getRightColumn() == rightColumn);
+}
+
+int main() {
+    for (int size: {15, 21, 7}) {
+        BoardGrid grid(size);
+        checkAgainstScan(grid);
+
+        // A small cross, then a tile out in the corner to stretch the bounding box.
+        grid.setTile(3, 3, Tile('C', 3));
+        grid.setTile(3, 4, Tile('A', 1));
+        grid.setTile(3, 5, Tile('T', 1));
+        grid.setTile(4, 4, Tile('X', 8));
+        grid.setTile(size - 1, size - 1, Tile('Z', 10));
+        checkAgainstScan(grid);
+
+        // Replacing a tile moves nothing.
+        grid.setTile(3, 4, Tile('O', 1));
+        checkAgainstScan(grid);
+        CHECK(grid.getTileCount() == 5);
+
+        // Setting an empty tile removes the tile, and shrinks the box back down.
+        grid.setTile(size - 1, size - 1, Tile());
+        checkAgainstScan(grid);
+        CHECK(grid.getTileCount() == 4);
+        CHECK(grid.getBottomRow() == 4);
+
+        // ...and is harmless on a square that is already empty.
+        grid.setTile(0, 0, Tile());
+        checkAgainstScan(grid);
+
+        grid.clearSquare(3, 3);
+        grid.setTile(3, 5, Tile());
+        checkAgainstScan(grid);
+
+        grid.clearSquare(3, 4);
+        grid.setTile(4, 4, Tile());
+        checkAgainstScan(grid);
+        CHECK(grid.getTileCount() == 0);
+        CHECK(grid.getTopRow() == -1);
+    }
+
+    // Random placements and removals (through both clearSquare() and an empty tile).
+    std::mt19937 random(2022);
+    for (int size: {15, 21}) {
+        BoardGrid grid(size);
+
+        for (int step = 0; step < 500; ++step) {
+            int row = static_cast<int>(random() % size);
+            int col = static_cast<int>(random() % size);
+
+            switch (random() % 3) {
+                case 0:
+                    grid.clearSquare(row, col);
+                    break;
+                case 1:
+                    grid.setTile(row, col, Tile());
+                    break;
+                default:
+                    grid.setTile(row, col, Tile(static_cast<Letter>('A' + random() % 26), 1));
+            }
+            checkAgainstScan(grid);
+        }
+    }
+
+    return unittest::finish();
+}
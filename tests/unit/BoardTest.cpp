@@ -0,0 +1,448 @@
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "UnitTest.h"
+#include "../../scrabble/core/gameboard/Board.h"
+#include "../../scrabble/core/lexicon/DawgBuilder.h"
+
+/*
+ * Checks the state a Board keeps up to date as tiles are placed, removed, undone and redone
+ * against the same state worked out from scratch, and that undoing and redoing moves always
+ * returns the board to exactly where it was. Moves are also scored against scores worked out by
+ * hand on the standard premium squares, and against a plain rescan of the words they form.
+ *
+ * Usage: BoardTest <words list> <standard premium squares>
+ */
+
+// Reads the run of letters from a square onwards in one direction, up to the first empty square.
+static std::string readRun(const BoardGrid &grid, int row, int col, int rowStep, int colStep) {
+    std::string run;
+
+    while (row >= 0 && col >= 0 && row < grid.size() && col < grid.size() &&
+           !grid.isEmpty(row, col)) {
+        run += grid.getLetter(row, col);
+        row += rowStep;
+        col += colStep;
+    }
+    return run;
+}
+
+// Works out a square's cross-check by trying every letter in the word it would be part of.
+static LetterMask scanCrossCheck(const Board &board, const Lexicon &lexicon, int row, int col,
+                                 Direction direction) {
+    const BoardGrid &grid = *board.getBoardGrid();
+    LetterMask check = 0;
+
+    if (grid.isEmpty(row, col)) {
+        int rowStep = direction == Direction::VERTICAL ? 1 : 0;
+        int colStep = direction == Direction::HORIZONTAL ? 1 : 0;
+        std::string before = readRun(grid, row - rowStep, col - colStep, -rowStep, -colStep);
+        std::string after = readRun(grid, row + rowStep, col + colStep, rowStep, colStep);
+        before = std::string(before.rbegin(), before.rend());
+
+        if (before.empty() && after.empty()) {
+            check = ANY_LETTER;
+        } else {
+            for (char letter = 'A'; letter <= 'Z'; ++letter) {
+                if (lexicon.contains(before + letter + after)) {
+                    check |= 1u << (letter - 'A');
+                }
+            }
+        }
+    }
+
+    return check;
+}
+
+// Returns every cross-check of the board, in both directions.
+static std::vector<LetterMask> getCrossChecks(const Board &board) {
+    std::vector<LetterMask> checks;
+
+    for (int row = 0; row < board.getSize(); ++row) {
+        for (int col = 0; col < board.getSize(); ++col) {
+            checks.push_back(board.getCrossCheck(row, col, Direction::HORIZONTAL));
+            checks.push_back(board.getCrossCheck(row, col, Direction::VERTICAL));
+        }
+    }
+    return checks;
+}
+
+/*
+ * Compares the incrementally kept cross-checks with a scan, and with a full recompute (attaching
+ * the lexicon again works every cross-check out from scratch).
+ */
+static void checkCrossChecks(Board &board, const Lexicon &lexicon) {
+    std::vector<LetterMask> kept = getCrossChecks(board);
+    std::size_t i = 0;
+
+    for (int row = 0; row < board.getSize(); ++row) {
+        for (int col = 0; col < board.getSize(); ++col) {
+            CHECK(kept[i++] == scanCrossCheck(board, lexicon, row, col, Direction::HORIZONTAL));
+            CHECK(kept[i++] == scanCrossCheck(board, lexicon, row, col, Direction::VERTICAL));
+        }
+    }
+
+    board.setLexicon(&lexicon);
+    CHECK(getCrossChecks(board) == kept);
+}
+
+static void placeWord(Board &board, const std::string &word, char row, int col,
+                      Direction direction) {
+    for (std::size_t i = 0; i < word.length(); ++i) {
+        bool vertical = direction == Direction::VERTICAL;
+        char square = static_cast<char>(vertical ? row + static_cast<int>(i) : row);
+        int column = vertical ? col : col + static_cast<int>(i);
+
+        if (board.getBoardGrid()->isEmpty(square - 'A', column)) {
+            board.placeTile(Tile(word[i], 1), square, column);
+        }
+    }
+}
+
+static void testCrossChecks(const Lexicon &lexicon) {
+    Board board(Board::STANDARD_SIZE, false);
+
+    // Nothing is ruled out while no lexicon is attached.
+    board.placeTile(Tile('Q', 10), 'H', 7);
+    CHECK(board.getCrossCheck(7, 8, Direction::HORIZONTAL) == ANY_LETTER);
+    board.undoMove();
+
+    board.setLexicon(&lexicon);
+    checkCrossChecks(board, lexicon);
+
+    // Words crossing each other, with tiles placed, undone and redone in between.
+    board.beginMove();
+    placeWord(board, "CAT", 'H', 6, Direction::HORIZONTAL);
+    checkCrossChecks(board, lexicon);
+
+    board.beginMove();
+    placeWord(board, "TOE", 'H', 8, Direction::VERTICAL);
+    checkCrossChecks(board, lexicon);
+
+    board.beginMove();
+    placeWord(board, "ZA", 'G', 7, Direction::VERTICAL);
+    checkCrossChecks(board, lexicon);
+
+    board.undoMove();
+    checkCrossChecks(board, lexicon);
+    board.undoMove();
+    checkCrossChecks(board, lexicon);
+    board.redoMove();
+    checkCrossChecks(board, lexicon);
+
+    // Unjournalled removals are kept up to date too.
+    board.removeTile('H', 7);
+    checkCrossChecks(board, lexicon);
+
+    // Random tiles, undos and redos, checked after every change.
+    Board randomBoard(Board::STANDARD_SIZE, false);
+    randomBoard.setLexicon(&lexicon);
+    std::mt19937 random(2022);
+
+    for (int step = 0; step < 60; ++step) {
+        int choice = static_cast<int>(random() % 6);
+
+        if (choice == 0) {
+            randomBoard.undoMove();
+        } else if (choice == 1) {
+            randomBoard.redoMove();
+        } else {
+            char row = static_cast<char>('A' + random() % 7 + 4);
+            int col = static_cast<int>(random() % 7 + 4);
+
+            if (choice == 2) {
+                randomBoard.beginMove();
+            }
+            if (randomBoard.getBoardGrid()->isEmpty(row - 'A', col)) {
+                // Mostly common letters, so that the words formed are often real.
+                randomBoard.placeTile(Tile("AEIOUSTRNL"[random() % 10], 1), row, col);
+            }
+        }
+        checkCrossChecks(randomBoard, lexicon);
+    }
+}
+
+// Everything a board keeps track of, so that two points in its history can be compared.
+struct Snapshot {
+    std::string letters;
+    int tileCount;
+    int bounds[4];
+    Bitboard occupied;
+    Bitboard occupiedTransposed;
+    std::vector<LetterMask> crossChecks;
+
+    bool operator==(const Snapshot &other) const {
+        return letters == other.letters && tileCount == other.tileCount &&
+               std::equal(bounds, bounds + 4, other.bounds) && occupied == other.occupied &&
+               occupiedTransposed == other.occupiedTransposed && crossChecks == other.crossChecks;
+    }
+};
+
+static Snapshot takeSnapshot(const Board &board) {
+    const BoardGrid &grid = *board.getBoardGrid();
+
+    return {std::string(grid.data(), grid.size() * grid.size()), grid.getTileCount(),
+            {grid.getTopRow(), grid.getBottomRow(), grid.getLeftColumn(), grid.getRightColumn()},
+            grid.getOccupied(), grid.getOccupiedTransposed(), getCrossChecks(board)};
+}
+
+static void testUndoRedo(const Lexicon &lexicon) {
+    Board board(Board::STANDARD_SIZE, false);
+    board.setLexicon(&lexicon);
+    Snapshot empty = takeSnapshot(board);
+
+    // Nothing to undo or redo on a fresh board.
+    CHECK(!board.canUndoMove());
+    CHECK(!board.canRedoMove());
+    CHECK(!board.undoMove());
+    CHECK(!board.redoMove());
+    CHECK(takeSnapshot(board) == empty);
+
+    board.beginMove();
+    placeWord(board, "CAT", 'H', 6, Direction::HORIZONTAL);
+    Snapshot afterFirst = takeSnapshot(board);
+    CHECK(afterFirst.tileCount == 3);
+    CHECK(board.canUndoMove());
+    CHECK(!board.canRedoMove());
+
+    board.beginMove();
+    placeWord(board, "TOE", 'H', 8, Direction::VERTICAL);
+    Snapshot afterSecond = takeSnapshot(board);
+    CHECK(afterSecond.tileCount == 5);
+    checkCrossChecks(board, lexicon);
+
+    // Place, undo, redo, undo again: every step lands back on exactly the same state.
+    CHECK(board.undoMove());
+    CHECK(takeSnapshot(board) == afterFirst);
+    CHECK(board.canUndoMove());
+    CHECK(board.canRedoMove());
+    checkCrossChecks(board, lexicon);
+
+    CHECK(board.redoMove());
+    CHECK(takeSnapshot(board) == afterSecond);
+    CHECK(!board.canRedoMove());
+
+    CHECK(board.undoMove());
+    CHECK(takeSnapshot(board) == afterFirst);
+    CHECK(board.undoMove());
+    CHECK(takeSnapshot(board) == empty);
+    CHECK(!board.canUndoMove());
+    CHECK(board.canRedoMove());
+
+    // Both moves can be redone in order.
+    CHECK(board.redoMove());
+    CHECK(takeSnapshot(board) == afterFirst);
+    CHECK(board.redoMove());
+    CHECK(takeSnapshot(board) == afterSecond);
+
+    // Beginning a move after an undo throws away the moves that could have been redone.
+    CHECK(board.undoMove());
+    CHECK(board.undoMove());
+    board.beginMove();
+    CHECK(!board.canRedoMove());
+    placeWord(board, "DOG", 'C', 2, Direction::HORIZONTAL);
+    Snapshot replaced = takeSnapshot(board);
+    CHECK(!board.canRedoMove());
+    CHECK(!board.redoMove());
+    CHECK(takeSnapshot(board) == replaced);
+    checkCrossChecks(board, lexicon);
+
+    CHECK(board.undoMove());
+    CHECK(takeSnapshot(board) == empty);
+    CHECK(!board.canUndoMove());
+    CHECK(board.redoMove());
+    CHECK(takeSnapshot(board) == replaced);
+
+    // Placing a tile after an undo, without beginning a move, starts a new move by itself.
+    CHECK(board.undoMove());
+    board.placeTile(Tile('Q', 10), 'A', 0);
+    CHECK(!board.canRedoMove());
+    CHECK(takeSnapshot(board).tileCount == 1);
+    CHECK(board.undoMove());
+    CHECK(takeSnapshot(board) == empty);
+}
+
+// The standard value of each letter's tiles (see resources/scrabbletiles.txt).
+static const Value LETTER_VALUES[26] = {1, 3, 3, 2, 1, 4, 2, 4, 1, 8, 5, 1, 3,
+                                        1, 1, 3, 10, 1, 1, 1, 1, 4, 4, 8, 4, 10};
+
+/*
+ * Places the letters of a word that are not already on the board, at their standard values, as
+ * a new move. Returns the squares they were placed on (as row and column indexes).
+ */
+static std::vector<std::pair<int, int> > playWord(Board &board, const std::string &word, char row,
+                                                  int col, Direction direction) {
+    std::vector<std::pair<int, int> > placedSquares;
+    board.beginMove();
+
+    for (std::size_t i = 0; i < word.length(); ++i) {
+        bool vertical = direction == Direction::VERTICAL;
+        char square = static_cast<char>(vertical ? row + static_cast<int>(i) : row);
+        int column = vertical ? col : col + static_cast<int>(i);
+
+        if (board.getBoardGrid()->isEmpty(square - 'A', column)) {
+            board.placeTile(Tile(word[i], LETTER_VALUES[word[i] - 'A']), square, column);
+            placedSquares.push_back(Board::logicalCoordsToIndexes(square, column));
+        }
+    }
+    return placedSquares;
+}
+
+/*
+ * Scores a move the long way round: every word through the squares placed on is found by walking
+ * the board square by square, kept once in a set, and scored square by square with the premium
+ * squares' getters.
+ */
+static int rescoreMove(const Board &board, const std::vector<std::pair<int, int> > &placed) {
+    const BoardGrid &grid = *board.getBoardGrid();
+    const PremiumSquares &premiums = board.getPremiumSquares();
+    std::set<std::tuple<int, int, int> > words;
+
+    for (auto &square: placed) {
+        for (int vertical = 0; vertical < 2; ++vertical) {
+            int rowStep = vertical;
+            int colStep = 1 - vertical;
+            int row = square.first;
+            int col = square.second;
+
+            while (row - rowStep >= 0 && col - colStep >= 0 &&
+                   !grid.isEmpty(row - rowStep, col - colStep)) {
+                row -= rowStep;
+                col -= colStep;
+            }
+
+            int length = 0;
+            while (row + rowStep * length < grid.size() && col + colStep * length < grid.size() &&
+                   !grid.isEmpty(row + rowStep * length, col + colStep * length)) {
+                ++length;
+            }
+
+            if (length >= 2) {
+                words.insert(std::make_tuple(vertical, row * grid.size() + col, length));
+            }
+        }
+    }
+
+    int score = 0;
+    for (auto &word: words) {
+        int vertical = std::get<0>(word);
+        int wordScore = 0;
+        int wordMultiplier = 1;
+
+        for (int i = 0; i < std::get<2>(word); ++i) {
+            int row = std::get<1>(word) / grid.size() + vertical * i;
+            int col = std::get<1>(word) % grid.size() + (1 - vertical) * i;
+            bool isNew = std::find(placed.begin(), placed.end(), std::make_pair(row, col)) !=
+                         placed.end();
+
+            if (isNew) {
+                wordScore += grid.getValue(row, col) * premiums.getLetterMultiplier(row, col);
+                wordMultiplier *= premiums.getWordMultiplier(row, col);
+            } else {
+                wordScore += grid.getValue(row, col);
+            }
+        }
+        score += wordScore * wordMultiplier;
+    }
+    return score;
+}
+
+static void testScoring(const std::string &premiumSquaresPath) {
+    PremiumSquares layout = PremiumSquares::readFromFile(premiumSquaresPath);
+    Board board(Board::STANDARD_SIZE, false);
+    board.setPremiumSquares(layout);
+
+    // The standard layout, read in as expected.
+    const PremiumSquares &premiums = board.getPremiumSquares();
+    CHECK(premiums.getWordMultiplier(0, 0) == 3 && premiums.getLetterMultiplier(0, 0) == 1);
+    CHECK(premiums.getWordMultiplier(7, 7) == 2);
+    CHECK(premiums.getLetterMultiplier(7, 3) == 2 && premiums.getWordMultiplier(7, 3) == 1);
+    CHECK(premiums.getLetterMultiplier(5, 5) == 3);
+    CHECK(premiums.getLetterMultiplier(7, 4) == 1 && premiums.getWordMultiplier(7, 4) == 1);
+
+    // HOUSE across H3-H7: H on a double letter, E on the centre's double word.
+    // (4 * 2 + 1 + 1 + 1 + 1) * 2 = 24.
+    CHECK(board.scoreMove(playWord(board, "HOUSE", 'H', 3, Direction::HORIZONTAL)) == 24);
+
+    // HOUSES: only the S is new, so neither of the earlier premiums count again.
+    // 4 + 1 + 1 + 1 + 1 + 1 = 9.
+    CHECK(board.scoreMove(playWord(board, "HOUSES", 'H', 3, Direction::HORIZONTAL)) == 9);
+
+    /*
+     * AT across I6-I7, under the S and E: the A is on a double letter, which counts in both of
+     * the words through it. AT = 1 * 2 + 1 = 3, SA = 1 + 1 * 2 = 3, ET = 1 + 1 = 2 (the centre
+     * having been covered already), so 8 in all.
+     */
+    CHECK(board.scoreMove(playWord(board, "AT", 'I', 6, Direction::HORIZONTAL)) == 8);
+
+    Board fresh(Board::STANDARD_SIZE, false);
+    fresh.setPremiumSquares(layout);
+
+    // ABSOLUTE across H0-H7 touches a triple word, a double letter and a double word square:
+    // (1 + 3 + 1 + 1 * 2 + 1 + 1 + 1 + 1) * 3 * 2 = 66.
+    CHECK(fresh.scoreMove(playWord(fresh, "ABSOLUTE", 'H', 0, Direction::HORIZONTAL)) == 66);
+
+    // The same tiles are scored the same by a plain rescan.
+    fresh.undoMove();
+    CHECK(rescoreMove(fresh, playWord(fresh, "ABSOLUTE", 'H', 0, Direction::HORIZONTAL)) == 66);
+
+    // BALLADE down E4-K4, through the L, covers the double word squares at E4 and K4:
+    // (3 + 1 + 1 + 1 + 1 + 2 + 1) * 2 * 2 = 40.
+    CHECK(fresh.scoreMove(playWord(fresh, "BALLADE", 'E', 4, Direction::VERTICAL)) == 40);
+
+    /*
+     * Random moves (runs of tiles along a row or column, connected or not), checked against the
+     * plain rescan. Whether they are words does not matter to the score.
+     */
+    std::mt19937 random(2022);
+    Board randomBoard(Board::STANDARD_SIZE, false);
+    randomBoard.setPremiumSquares(layout);
+
+    for (int move = 0; move < 300; ++move) {
+        bool vertical = random() % 2 == 0;
+        int line = static_cast<int>(random() % Board::STANDARD_SIZE);
+        int from = static_cast<int>(random() % Board::STANDARD_SIZE);
+        int count = 1 + static_cast<int>(random() % 7);
+        std::vector<std::pair<int, int> > placed;
+
+        randomBoard.beginMove();
+        for (int pos = from; pos < Board::STANDARD_SIZE && static_cast<int>(placed.size()) < count;
+             ++pos) {
+            int row = vertical ? pos : line;
+            int col = vertical ? line : pos;
+
+            if (randomBoard.getBoardGrid()->isEmpty(row, col)) {
+                Letter letter = static_cast<Letter>('A' + random() % 26);
+                randomBoard.placeTile(Tile(letter, LETTER_VALUES[letter - 'A']),
+                                      static_cast<char>('A' + row), col);
+                placed.emplace_back(row, col);
+            }
+        }
+
+        CHECK(randomBoard.scoreMove(placed) == rescoreMove(randomBoard, placed));
+
+        // Clear the board every so often, so that it does not fill up.
+        if (move % 30 == 29) {
+            while (randomBoard.undoMove()) {
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        std::cout << "Usage: " << argv[0] << " <words list> <standard premium squares>"
+                  << std::endl;
+        return 1;
+    }
+
+    Lexicon lexicon(DawgBuilder::buildFromWordsFile(argv[1]));
+    testCrossChecks(lexicon);
+    testUndoRedo(lexicon);
+    testScoring(argv[2]);
+
+    return unittest::finish();
+}
@@ -0,0 +1,133 @@
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "UnitTest.h"
+#include "../../scrabble/core/lexicon/DawgBuilder.h"
+#include "../../scrabble/core/lexicon/Lexicon.h"
+
+/*
+ * Checks PatternIterator (through Lexicon::findMatches()) and Lexicon::getWordLengths() against a
+ * brute-force scan of the words list.
+ *
+ * Usage: PatternIteratorTest <words list>
+ */
+
+// Returns the set of letters in the string (in either case).
+static LetterMask maskOf(const std::string &letters) {
+    LetterMask mask = 0;
+    for (char letter: letters) {
+        mask |= 1u << (std::tolower(static_cast<unsigned char>(letter)) - 'a');
+    }
+    return mask;
+}
+
+static std::vector<std::string> scan(const std::vector<std::string> &wordsList,
+                                     const std::vector<LetterMask> &allowedLetters) {
+    std::vector<std::string> found;
+    for (const auto &word: wordsList) {
+        bool matches = word.length() == allowedLetters.size();
+        for (std::size_t i = 0; i < word.length() && matches; ++i) {
+            matches = (allowedLetters[i] & (1u << (word[i] - 'a'))) != 0;
+        }
+        if (matches) {
+            found.push_back(word);
+        }
+    }
+    return found;
+}
+
+// Runs the iterator dry, checking that it stays exhausted once it has run out.
+static std::vector<std::string> drain(PatternIterator matches) {
+    std::vector<std::string> found;
+    while (matches.next()) {
+        found.push_back(matches.getWord());
+    }
+    CHECK(!matches.next());
+    CHECK(!matches.next());
+    return found;
+}
+
+static void checkPattern(const Lexicon &lexicon, const std::vector<std::string> &wordsList,
+                         const std::vector<LetterMask> &allowedLetters, const std::string &name) {
+    std::vector<std::string> expected = scan(wordsList, allowedLetters);
+    std::vector<std::string> pruned = drain(lexicon.findMatches(allowedLetters));
+    // Without the word lengths, nothing is pruned by length, so the two must still agree.
+    std::vector<std::string> unpruned = drain(PatternIterator(lexicon.getDawg(), allowedLetters));
+
+    if (expected != pruned || expected != unpruned) {
+        std::cout << "Pattern " << name << ": expected " << expected.size() << " matches, got "
+                  << pruned.size() << " (" << unpruned.size() << " without word lengths)"
+                  << std::endl;
+    }
+    CHECK(expected == pruned);
+    CHECK(expected == unpruned);
+    // Matches come out in alphabetical order.
+    CHECK(std::is_sorted(pruned.begin(), pruned.end()));
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        std::cout << "Usage: " << argv[0] << " <words list>" << std::endl;
+        return 1;
+    }
+
+    std::vector<std::string> wordsList = unittest::readWordsList(argv[1]);
+    Lexicon lexicon(DawgBuilder::buildFromWordsFile(argv[1]));
+    std::size_t longestWord = 0;
+    for (const auto &word: wordsList) {
+        longestWord = std::max(longestWord, word.length());
+    }
+
+    // Fixed letters, wildcards and both mixed, written as strings (in either case).
+    for (const std::string pattern: {"QU???", "qu???", "?A??S", "??", "?????", "ZYZZYVA", "XQ?"}) {
+        std::vector<LetterMask> allowedLetters;
+        for (char square: pattern) {
+            allowedLetters.push_back(square == '?' ? ANY_LETTER : maskOf(std::string(1, square)));
+        }
+
+        CHECK(drain(lexicon.findMatches(pattern)) == scan(wordsList, allowedLetters));
+        checkPattern(lexicon, wordsList, allowedLetters, "\"" + pattern + "\"");
+    }
+
+    // Per-square letter sets, such as the cross-checks of the squares a move would cover.
+    checkPattern(lexicon, wordsList, {maskOf("aeiou"), ANY_LETTER, maskOf("xz"), ANY_LETTER},
+                 "[aeiou]?[xz]?");
+    checkPattern(lexicon, wordsList, {maskOf("st"), maskOf("aeiou"), maskOf("aeiou"), maskOf("nr")},
+                 "[st][aeiou][aeiou][nr]");
+    checkPattern(lexicon, wordsList, {ANY_LETTER, 0, ANY_LETTER}, "?[]?");
+
+    // Nothing is longer than the longest word, however open the pattern.
+    std::vector<LetterMask> tooLong(longestWord + 1, ANY_LETTER);
+    CHECK(drain(lexicon.findMatches(tooLong)).empty());
+    CHECK(drain(lexicon.findMatches(std::string(longestWord + 1, '?'))).empty());
+    CHECK(!drain(lexicon.findMatches(std::vector<LetterMask>(longestWord, ANY_LETTER))).empty());
+
+    // Bit k of an edge's word lengths is set if some word ends k letters after the edge.
+    const Dawg &dawg = lexicon.getDawg();
+    const std::vector<std::uint32_t> &wordLengths = lexicon.getWordLengths();
+    CHECK(wordLengths.size() == dawg.edgeCount());
+
+    for (int letter = 0; letter < 26; ++letter) {
+        std::uint32_t expected = 0;
+        for (const auto &word: wordsList) {
+            if (word[0] - 'a' == letter) {
+                expected |= 1u << (word.length() - 1);
+            }
+        }
+
+        std::uint32_t edge = dawg.findEdge(dawg.root(), letter);
+        CHECK((edge == Dawg::NONE ? 0 : wordLengths[edge]) == expected);
+    }
+
+    bool rejected = false;
+    try {
+        lexicon.findMatches("A-B");
+    } catch (std::invalid_argument &badPattern) {
+        rejected = true;
+    }
+    CHECK(rejected);
+
+    return unittest::finish();
+}
@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "UnitTest.h"
+#include "../../scrabble/core/Rack.h"
+
+/*
+ * Checks the rack against a plain model: a stack of tiles per slot (the latest tile of a letter
+ * being the one taken out) and a list in the order they are shown (a tile taken out leaving its
+ * place to the last tile). Tiles are told apart by their values, which are unique among the tiles
+ * held, and the few letters used (along with a tile that is not a letter) make sure that each
+ * slot holds several tiles at once.
+ */
+
+static const Letter LETTERS[] = {'A', 'B', 'C', 'Z', '?'};
+
+// Checks every way of reading the rack against the model.
+static void checkAgainstModel(const Rack &rack, const std::vector<std::vector<Tile> > &slots,
+                              const std::vector<Tile> &shown) {
+    CHECK(rack.size() == static_cast<int>(shown.size()));
+    CHECK(rack.getTiles() == shown);
+
+    for (int slot = 0; slot < Rack::SLOTS; ++slot) {
+        CHECK(rack.getCounts()[slot] == slots[slot].size());
+    }
+
+    for (Letter letter: LETTERS) {
+        int count = static_cast<int>(slots[Rack::getSlot(letter)].size());
+        CHECK(rack.getCount(letter) == count);
+        CHECK(rack.contains(letter) == (count != 0));
+    }
+}
+
+int main() {
+    Rack rack;
+    std::vector<std::vector<Tile> > slots(Rack::SLOTS);
+    std::vector<Tile> shown;
+    std::mt19937 random(2022);
+    Value nextValue = 0;
+
+    for (int step = 0; step < 4000; ++step) {
+        Letter letter = LETTERS[random() % 5];
+        int slot = Rack::getSlot(letter);
+
+        // Lean towards adding while the rack is small, so that it fills up and empties out.
+        if (random() % 16 >= shown.size()) {
+            // Skip values still held, so that the tile can be told apart from the rest.
+            while (std::find(shown.begin(), shown.end(), Tile(letter, nextValue)) != shown.end()) {
+                nextValue = static_cast<Value>((nextValue + 1) % 100);
+            }
+            Tile tile(letter, nextValue);
+            nextValue = static_cast<Value>((nextValue + 1) % 100);
+
+            rack.add(tile);
+            slots[slot].push_back(tile);
+            shown.push_back(tile);
+        } else {
+            Tile removed('X', -1);
+            bool held = rack.remove(letter, removed);
+
+            CHECK(held == !slots[slot].empty());
+            if (held) {
+                CHECK(removed == slots[slot].back());
+
+                auto place = std::find(shown.begin(), shown.end(), slots[slot].back());
+                *place = shown.back();
+                shown.pop_back();
+                slots[slot].pop_back();
+            } else {
+                CHECK(removed == Tile('X', -1));
+            }
+        }
+
+        checkAgainstModel(rack, slots, shown);
+    }
+
+    // Shown and saved in the same order.
+    Rack small;
+    small.add(Tile('A', 1));
+    small.add(Tile('B', 3));
+    small.add(Tile('A', 1));
+    small.add(Tile('C', 3));
+    Tile removed;
+    CHECK(small.remove('B', removed) && removed == Tile('B', 3));
+    CHECK(small.serialiseToString() == "A-1, C-3, A-1");
+
+    return unittest::finish();
+}
@@ -0,0 +1,110 @@
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include "UnitTest.h"
+#include "../../scrabble/utility/Random.h"
+
+/*
+ * Checks the generator against known outputs: splitmix64 spreads a seed of 0 over the state as
+ * 0xe220a8397b1dcdaf, 0x6e789e6aa1b965f4, 0x06c45d188009454f, 0xf88bb8a8724c81ec (its first four
+ * outputs), from which xoshiro256** gives the numbers below. Also checks that nextBelow() stays
+ * in range and rejects exactly the biased values, and that a serialised generator carries on
+ * with the same numbers.
+ */
+
+// Returns whether restoring a generator from the given string throws a runtime error.
+static bool isRejected(const std::string &serialisedRandom) {
+    bool rejected = false;
+
+    try {
+        Random::fromString(serialisedRandom);
+    } catch (std::runtime_error &malformed) {
+        rejected = true;
+    }
+    return rejected;
+}
+
+/*
+ * Lemire's method written out plainly, for comparison: a value is rejected whenever the low half
+ * of the scaled number falls below 2^32 mod bound. Counts the values rejected.
+ */
+static std::uint32_t nextBelowByRejection(Random &random, std::uint32_t bound, int &rejections) {
+    std::uint32_t threshold = static_cast<std::uint32_t>((std::uint64_t(1) << 32) % bound);
+    std::uint64_t scaled = (random.next() >> 32) * bound;
+
+    while (static_cast<std::uint32_t>(scaled) < threshold) {
+        ++rejections;
+        scaled = (random.next() >> 32) * bound;
+    }
+    return static_cast<std::uint32_t>(scaled >> 32);
+}
+
+int main() {
+    // Known outputs.
+    Random zero(0);
+    CHECK(zero.serialiseToString() == "0 16294208416658607535 7960286522194355700 "
+                                      "487617019471545679 17909611376780542444");
+    CHECK(zero.next() == 0x99ec5f36cb75f2b4ULL);
+    CHECK(zero.next() == 0xbf6e1f784956452aULL);
+    CHECK(zero.next() == 0x1a5f849d4933e6e0ULL);
+    CHECK(zero.next() == 0x6aa594f1262d2d2cULL);
+    CHECK(zero.next() == 0xbba5ad4a1f842e59ULL);
+
+    Random seeded(2022);
+    CHECK(seeded.getSeed() == 2022);
+    CHECK(seeded.next() == 0x3240f99fbeb236c4ULL);
+    CHECK(seeded.next() == 0x97f4c24ed811819dULL);
+
+    // nextBelow() stays in range, including for bounds of 1 and the largest there are.
+    Random ranged(7);
+    for (std::uint32_t bound: {1u, 2u, 3u, 7u, 100u, 0x80000001u, 0xffffffffu}) {
+        for (int i = 0; i < 2000; ++i) {
+            CHECK(ranged.nextBelow(bound) < bound);
+        }
+    }
+
+    /*
+     * nextBelow() gives the same numbers as the plain method, and so uses up the same numbers. A
+     * bound just over 2^31 has nearly half of all values rejected, so rejection is well covered.
+     */
+    for (std::uint32_t bound: {3u, 100u, 0x80000001u}) {
+        Random fast(11);
+        Random plain(11);
+        int rejections = 0;
+
+        for (int i = 0; i < 2000; ++i) {
+            CHECK(fast.nextBelow(bound) == nextBelowByRejection(plain, bound, rejections));
+        }
+        CHECK(fast.next() == plain.next());
+        CHECK(bound != 0x80000001u || rejections > 500);
+    }
+
+    // Every number below a small bound comes up about as often as the rest.
+    Random uniform(13);
+    int counts[3] = {};
+    for (int i = 0; i < 30000; ++i) {
+        ++counts[uniform.nextBelow(3)];
+    }
+    for (int count: counts) {
+        CHECK(count > 9500 && count < 10500);
+    }
+
+    // A restored generator carries on exactly where the serialised one was.
+    Random original(2022);
+    for (int i = 0; i < 10; ++i) {
+        original.next();
+    }
+    Random restored = Random::fromString(original.serialiseToString());
+    CHECK(restored.getSeed() == 2022);
+    CHECK(restored.serialiseToString() == original.serialiseToString());
+    for (int i = 0; i < 100; ++i) {
+        CHECK(restored.next() == original.next());
+    }
+
+    CHECK(isRejected(""));
+    CHECK(isRejected("1 2 3 4"));
+    CHECK(isRejected("1 2 3 4 5 6"));
+    CHECK(isRejected("1 2 three 4 5"));
+
+    return unittest::finish();
+}
@@ -0,0 +1,81 @@
+#include <random>
+#include <stdexcept>
+#include "UnitTest.h"
+#include "../../scrabble/core/TileBag.h"
+
+/*
+ * Checks the tile bag's tree search against a plain walk of its letter counts: every position of
+ * the bag must hold the letter the walk finds there, all the way from a full bag to an empty one.
+ * Some letters start out with no tiles, and the rest are emptied one by one as the bag is drawn
+ * from, so the search has to skip over empty letters wherever they fall.
+ */
+
+// Returns the letter of the tile at a position, by walking the counts from 'A'.
+static Letter letterAtByWalk(const TileBag &bag, int position) {
+    Letter letter = 'A';
+    int remaining = position;
+
+    while (remaining >= bag.getCount(letter)) {
+        remaining -= bag.getCount(letter);
+        ++letter;
+    }
+    return letter;
+}
+
+// Returns whether drawing at the position is refused as being outside the bag.
+static bool isRejected(TileBag bag, int position) {
+    bool rejected = false;
+
+    try {
+        bag.drawAt(position);
+    } catch (std::out_of_range &outsideTheBag) {
+        rejected = true;
+    }
+    return rejected;
+}
+
+int main() {
+    TileBag bag;
+    int expectedSize = 0;
+
+    // Letters with counts of 0 to 5 (and values to match), so that some are never in the bag.
+    for (int i = 0; i < TileBag::LETTERS; ++i) {
+        int count = (i * 7) % 6;
+        bag.add(Tile(static_cast<Letter>('A' + i), static_cast<Value>(i + 1)), count);
+        expectedSize += count;
+    }
+    CHECK(bag.size() == expectedSize);
+
+    std::mt19937 random(2022);
+
+    while (!bag.isEmpty()) {
+        // Every position, drawn from a copy so that the bag itself is left alone.
+        for (int position = 0; position < bag.size(); ++position) {
+            Letter letter = letterAtByWalk(bag, position);
+            TileBag copy = bag;
+            Tile drawn = copy.drawAt(position);
+
+            CHECK(drawn == Tile(letter, static_cast<Value>(letter - 'A' + 1)));
+            CHECK(copy.getCount(letter) == bag.getCount(letter) - 1);
+            CHECK(copy.size() == bag.size() - 1);
+        }
+
+        CHECK(isRejected(bag, -1));
+        CHECK(isRejected(bag, bag.size()));
+
+        // Then draw from somewhere, emptying letters as it goes.
+        bag.drawAt(static_cast<int>(random() % bag.size()));
+        CHECK(bag.size() == --expectedSize);
+    }
+
+    CHECK(isRejected(bag, 0));
+
+    // Tiles put back are drawn again, even into a letter that had been emptied.
+    bag.add(Tile('Z', 26));
+    bag.add(Tile('A', 1), 2);
+    CHECK(bag.drawAt(2) == Tile('Z', 26));
+    CHECK(bag.drawAt(0) == Tile('A', 1));
+    CHECK(bag.serialiseToString() == "A-1");
+
+    return unittest::finish();
+}
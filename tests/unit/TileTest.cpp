@@ -0,0 +1,56 @@
+#include <stdexcept>
+#include "UnitTest.h"
+#include "../../scrabble/core/Player.h"
+#include "../../scrabble/core/Tile.h"
+#include "../../scrabble/core/TileCodec.h"
+#include "../../scrabble/utility/LinkedList.h"
+
+/*
+ * Checks that a tile keeps exactly the value it was given (or refuses one it cannot hold), and
+ * which types LinkedList accepts as serialisable.
+ */
+
+static_assert(IsSerialisable<Tile>::value, "plain tiles serialise themselves");
+static_assert(IsSerialisable<Player>::value, "Serialisable classes are serialisable");
+static_assert(IsSerialisable<LinkedList<Tile> >::value, "lists of tiles are serialisable");
+static_assert(!IsSerialisable<int>::value, "ints have no serialiseToString()");
+
+// Returns whether building (or revaluing) a tile with the given value throws a range error.
+static bool isRejected(Value value, bool viaSetter) {
+    bool rejected = false;
+
+    try {
+        if (viaSetter) {
+            Tile tile('A', 1);
+            tile.setValue(value);
+        } else {
+            Tile tile('A', value);
+        }
+    } catch (std::range_error &outOfRange) {
+        rejected = true;
+    }
+    return rejected;
+}
+
+int main() {
+    for (bool viaSetter: {false, true}) {
+        for (Value value: {-128, -1, 0, 1, 10, 127}) {
+            CHECK(!isRejected(value, viaSetter));
+        }
+        for (Value value: {-129, 128, 200, 256, 1000}) {
+            CHECK(isRejected(value, viaSetter));
+        }
+    }
+
+    // Values survive a trip through the saved form, right up to the largest a tile can hold.
+    for (Value value: {0, 1, 10, 127}) {
+        Tile tile('Q', value);
+        CHECK(tile.getValue() == value);
+        CHECK(TileCodec::decode(TileCodec::encode(tile)) == tile);
+    }
+
+    // A dummy tile (as found on an empty square) is worth -1.
+    CHECK(Tile().getValue() == -1);
+
+    return unittest::finish();
+}
@@ -0,0 +1,53 @@
+#ifndef ASSIGNMENT_2_NEW_UNITTEST_H
+#define ASSIGNMENT_2_NEW_UNITTEST_H
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+ * A minimal harness for the unit tests, each of which is its own executable run by ctest.
+ *
+ * CHECK records a failed condition (with where it failed) and carries on, so that one run reports
+ * every failure. Each test's main() ends with "return unittest::finish();", which turns the
+ * failure count into the exit status that ctest reads.
+ */
+namespace unittest {
+    inline int &failureCount() {
+        static int failures = 0;
+        return failures;
+    }
+
+    inline int finish() {
+        if (failureCount() > 0) {
+            std::cout << failureCount() << " check(s) failed." << std::endl;
+        }
+        return failureCount() == 0 ? 0 : 1;
+    }
+
+    // Reads every line of a words list, for checking the lexicon against a plain scan.
+    inline std::vector<std::string> readWordsList(const std::string &path) {
+        std::vector<std::string> words;
+        std::ifstream WordsFile(path);
+        std::string word;
+
+        while (std::getline(WordsFile, word)) {
+            if (!word.empty()) {
+                words.push_back(word);
+            }
+        }
+        return words;
+    }
+}
+
+#define CHECK(condition)                                                                        \
+    do {                                                                                        \
+        if (!(condition)) {                                                                     \
+            std::cout << __FILE__ << ":" << __LINE__ << ": CHECK(" #condition ") failed"       \
+                      << std::endl;                                                             \
+            ++unittest::failureCount();                                                         \
+        }                                                                                       \
+    } while (false)
+
+#endif //ASSIGNMENT_2_NEW_UNITTEST_H